@@ -0,0 +1,127 @@
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include "balance.h"
+#include "battle_ai.h"
+#include "pokedex.h"
+#include "threadpool.h"
+#include "poke_main.h"
+
+// A fight longer than this counts as a draw
+#define BALANCE_MAX_TURNS 200
+
+static bool writeCsv(const std::string& path, const std::vector<int>& ids, const std::vector<int>& levels, int battles,
+                     const std::vector<uint32_t>& wins, const std::vector<uint32_t>& draws, const std::vector<uint64_t>& turns) {
+    FILE* out = fopen(path.c_str(), "w");
+    if (!out) {
+        return false;
+    }
+    size_t n = ids.size();
+    fprintf(out, "attacker_id,attacker_level,defender_id,defender_level,battles,wins,draws,mean_turns\n");
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            size_t cell = i * n + j;
+            fprintf(out, "%d,%d,%d,%d,%d,%u,%u,%.2f\n", ids[i], levels[i], ids[j], levels[j], battles,
+                    wins[cell], draws[cell], (double) turns[cell] / battles);
+        }
+    }
+    return fclose(out) == 0;
+}
+
+static bool writeBinary(const std::string& path, const std::vector<int>& ids, const std::vector<int>& levels, int battles,
+                        const std::vector<uint32_t>& wins, const std::vector<uint32_t>& draws, const std::vector<uint64_t>& turns) {
+    std::ofstream out(path, std::ios::binary);
+    char magic[8] = "PKBAL2";
+    uint32_t header[2] = { (uint32_t) ids.size(), (uint32_t) battles };
+    out.write(magic, sizeof(magic));
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (const std::vector<int>* column : { &ids, &levels }) {
+        for (int value : *column) {
+            int32_t v = value;
+            out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+    }
+    std::vector<float> matrix(wins.size());
+    for (const std::vector<uint32_t>* counts : { &wins, &draws }) {
+        for (size_t cell = 0; cell < counts->size(); cell++) {
+            matrix[cell] = (float) (*counts)[cell] / battles;
+        }
+        out.write(reinterpret_cast<const char*>(matrix.data()), matrix.size() * sizeof(float));
+    }
+    for (size_t cell = 0; cell < turns.size(); cell++) {
+        matrix[cell] = (float) turns[cell] / battles;
+    }
+    out.write(reinterpret_cast<const char*>(matrix.data()), matrix.size() * sizeof(float));
+    return (bool) out;
+}
+
+int runBalance(const BalanceOptions& options) {
+    pokedex.wait();
+    const PokemonList* pokemonList = pokedex.pokemon();
+    if (!pokemonList || !pokedex.moves() || !pokedex.pokemonMoves() || !pokedex.pokemonStats()) {
+        fprintf(stderr, "balance: the pokedex tables could not be loaded\n");
+        return 1;
+    }
+    if (options.battles <= 0 || options.levels.empty()) {
+        fprintf(stderr, "balance: nothing to simulate\n");
+        return 1;
+    }
+
+    // One fixed roster entry per (species, level); moves and IVs are drawn
+    // once per entry so every battle of a pairing uses the same Pokemon
+    RngStream root(RngStream::mix(options.seed));
+    std::vector<BattleMon> mons;
+    std::vector<int> ids, levels;
+    for (int id = 1; id <= options.species; id++) {
+        const Pokemon* pokemon = pokemonList->getPokemonById(id);
+        if (!pokemon) {
+            continue;
+        }
+        for (int level : options.levels) {
+            RngStream rng = root.split(mons.size());
+            PokeData data;
+            buildPokemon(&data, *pokemon, level, rng);
+            mons.push_back(makeBattleMon(data));
+            ids.push_back(id);
+            levels.push_back(level);
+        }
+    }
+
+    size_t n = mons.size();
+    std::vector<uint32_t> wins(n * n, 0), draws(n * n, 0);
+    std::vector<uint64_t> turns(n * n, 0);
+    RngStream battleRoot = root.split(UINT64_MAX);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ThreadPool::shared().parallelFor(n, [&](size_t i) {
+        GreedyMovePolicy greedy;
+        for (size_t j = 0; j < n; j++) {
+            size_t cell = i * n + j;
+            RngStream pairing = battleRoot.split(cell);
+            for (int b = 0; b < options.battles; b++) {
+                BattleState state = makeDuel(mons[i], mons[j], pairing.split(b));
+                int winner = runBattle(state, greedy, greedy, BALANCE_MAX_TURNS);
+                wins[cell] += winner == 0;
+                draws[cell] += winner < 0;
+                turns[cell] += state.turn;
+            }
+        }
+    });
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t total = (uint64_t) n * n * options.battles;
+    printf("%llu battles (%zu entries, %d per pairing) in %.2f s on %u worker threads: %.0f battles/s\n",
+           (unsigned long long) total, n, options.battles, seconds, ThreadPool::shared().size(),
+           seconds > 0 ? total / seconds : 0.0);
+
+    const std::string& path = options.output;
+    bool binary = path.size() >= 4 && path.compare(path.size() - 4, 4, ".bin") == 0;
+    bool written = binary ? writeBinary(path, ids, levels, options.battles, wins, draws, turns)
+                          : writeCsv(path, ids, levels, options.battles, wins, draws, turns);
+    if (!written) {
+        fprintf(stderr, "balance: could not write %s\n", path.c_str());
+        return 1;
+    }
+    printf("wrote %s\n", path.c_str());
+    return 0;
+}
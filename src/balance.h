@@ -0,0 +1,34 @@
+// balance.h
+#ifndef BALANCE_H
+#define BALANCE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Headless matchup sweep for tuning encounter difficulty.  Every (species,
+// level) entry fights every entry, one on one with greedy move choice on
+// both sides, a fixed number of times.  The pairings are spread over the
+// shared thread pool and nothing touches the terminal.
+//
+// A CSV output has one line per pairing:
+//   attacker_id,attacker_level,defender_id,defender_level,battles,wins,draws,mean_turns
+// A ".bin" output holds, in native byte order:
+//   char magic[8] = "PKBAL2"; uint32_t entries, battles;
+//   int32_t id[entries], level[entries];
+//   float winRate[entries][entries];   // attacker row, defender column
+//   float drawRate[entries][entries];  // fights that hit the turn cap
+//   float meanTurns[entries][entries];
+struct BalanceOptions {
+    int battles;             // per pairing
+    int species;             // species ids 1..species
+    std::vector<int> levels;
+    std::string output;
+    uint32_t seed;
+};
+
+// Run the sweep, write the matrix and report throughput on stdout.
+// Returns 0 on success.
+int runBalance(const BalanceOptions& options);
+
+#endif // BALANCE_H
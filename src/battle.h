@@ -4,7 +4,9 @@
 #include "data.h"
 #include "io.h"
 #include "character.h"
-#include <random>
+#include "battle_ai.h"
+#include "experience.h"
+#include "rng.h"
 bool hasTriedToFlee = false;
 
 int handle_init_battle_choice(int playerChoice, pc* playerCharacter, PokeData*& playerPokemon, PokeData* npcPokemon, npc* nonPlayerCharacter) {
@@ -21,10 +23,7 @@ int handle_init_battle_choice(int playerChoice, pc* playerCharacter, PokeData*&
             }
         case 2: // Flee
             if (!hasTriedToFlee) {
-                std::random_device rd;
-                std::mt19937 gen(rd());
-                std::uniform_int_distribution<> dis(1, 100);
-                int chance = dis(gen);
+                int chance = rngStream(rng_battle).range(1, 100);
                 if (chance <= 20) { // 20% chance to flee successfully
                     hasTriedToFlee = false; //reset for next encounter
                     return 1; // Fleeing successful
@@ -49,187 +48,136 @@ int handle_init_battle_choice(int playerChoice, pc* playerCharacter, PokeData*&
     }
 }
 
-// Helper function to check if a Pokemon has fainted (HP is zero)
-bool isFainted(PokeData* pokeData) {
-    // Lambda to find the HP stat
-    auto findHP = [](const std::vector<PokeStats>& stats) -> const PokeStats* {
-        for (const auto& stat : stats) {
-            if (stat.getStatIdentifier() == "hp") {
-                return &stat;
-            }
+// Battle form of a character's party with the on-screen Pokemon leading;
+// members[i] is the PokeData behind team slot i
+void fillBattleSide(BattleSide& side, character* owner, PokeData* active, PokeData* members[BATTLE_MAX_TEAM]){
+    side.team[0] = makeBattleMon(*active);
+    members[0] = active;
+    side.teamSize = 1;
+    side.active = 0;
+    side.numPotions = 0;
+    if (!owner) {
+        return;
+    }
+    for (PokeData& pokemon : owner->getPokemons()) {
+        if (side.teamSize == BATTLE_MAX_TEAM) {
+            break;
+        }
+        if (&pokemon != active) {
+            members[side.teamSize] = &pokemon;
+            side.team[side.teamSize++] = makeBattleMon(pokemon);
         }
-        return nullptr; // HP stat not found
-    };
-    const PokeStats* hpStat = findHP(pokeData->getStatsList());
-    return hpStat && hpStat->getStatRating() <= 0;
+    }
+    for (Potion* potion : owner->getPotions()) {
+        if (side.numPotions == BATTLE_MAX_POTIONS) {
+            break;
+        }
+        side.potions[side.numPotions++] = potion->getHealingAmount();
+    }
 }
 
-void applyDamage(PokeData* poke, int damage){
-
-     // Lambda to find the HP stat
-    auto findHP = [](const std::vector<PokeStats>& stats) -> const PokeStats* {
-        for (const auto& stat : stats) {
-            if (stat.getStatIdentifier() == "hp") {
-                return &stat;
-            }
+// Copy the HP and PP of every team member back into its PokeData
+void storeBattleState(const BattleState& state, PokeData* members[2][BATTLE_MAX_TEAM]){
+    for (int side = 0; side < 2; side++) {
+        for (int i = 0; i < state.sides[side].teamSize; i++) {
+            storeBattleMon(state.sides[side].team[i], *members[side][i]);
         }
-        return nullptr; // HP stat not found
-    };
-
-    // Find HP stat for the Pokemon
-    const PokeStats* hpStat = findHP(poke->getStatsList());
-
-    if (hpStat != nullptr) {
-        // Calculate new HP, ensuring it doesn't go below 0
-        int newHP = std::max(0, hpStat->getStatRating() - damage);
-        // Set the new HP using modifyStat
-        poke->modifyStat("hp", newHP);
     }
-
-
 }
 
-bool isCritical(){
-    //random chance (for now 50% chance)
-    return true;
+// Play one turn for the two Pokemon on screen.  The NPC picks its best move,
+// or with a lookahead budget set, its best move or potion by Monte Carlo
+// playouts of the rest of the battle; the screens cannot follow an NPC
+// switch, so it never switches here.  HP and PP changes are copied back into
+// the PokeData and a potion the NPC drinks leaves its bag.
+TurnResult playBattleTurn(pc* playerCharacter, PokeData* playerPokemon, npc* nonPlayerCharacter, PokeData* nonPlayerPokemon, const BattleAction& playerAction){
+    if (!playerPokemon || !nonPlayerPokemon) {
+        return TurnResult{}; // nobody on the field to fight
+    }
+    BattleState state;
+    PokeData* members[2][BATTLE_MAX_TEAM];
+    fillBattleSide(state.sides[0], playerCharacter, playerPokemon, members[0]);
+    fillBattleSide(state.sides[1], nonPlayerCharacter, nonPlayerPokemon, members[1]);
+    state.turn = 0;
+    state.rng = RngStream(rngStream(rng_battle).next());
+
+    BattleAction npcAction;
+    if (trainerLookaheadMs > 0) {
+        npcAction = MonteCarloPolicy(trainerLookaheadMs, false).chooseAction(state, 1);
+    } else {
+        npcAction = GreedyMovePolicy().chooseAction(state, 1);
+    }
+    TurnResult result = resolveTurn(state, playerAction, npcAction);
+    storeBattleState(state, members);
+    if (npcAction.type == action_potion && nonPlayerCharacter) {
+        std::vector<Potion*>& potions = nonPlayerCharacter->getPotions();
+        delete potions[npcAction.index];
+        potions.erase(potions.begin() + npcAction.index);
+        io_queue_message("The opponent used a potion and restored %d HP.", result.healed[1]);
+    }
+    return result;
 }
 
-int processMoveDamage(PokeData* pokeData, const Moves* move, bool isCritical){
-    //exp1=(2*level)/5 +2
-    //exp2 = exp1 * power * (attack/defense)
-    //exp3 = (exp2/50 + 2) * critical * random 
-    //where random is uniformially distributed number [85-100]
-    // critical is 1.5 if ture of 1 if not
-
-    // Placeholder values for level, attack, and defense
-    int level = 50; // Example level
-    int attack = 100; // Example attack stat
-    int defense = 100; // Example defense stat
-
-    int exp1 = (2 * level) / 5 + 2;
-    int exp2 = exp1 * move->getPower() * (attack / defense);
-    double critical = isCritical ? 1.5 : 1.0;
-    int randomFactor = (rand() % (100 - 85 + 1)) + 85; // Random number between 85 and 100
-    int exp3 = static_cast<int>(((exp2 / 50 + 2) * critical * randomFactor) / 100.0);
-
-    return exp3;
+// Fight a whole trainer battle off screen (soak runs), greedy play on both
+// sides.  The trainer counts as beaten whoever wins.
+void autoBattle(pc* playerCharacter, npc* nonPlayerCharacter){
+    std::vector<PokeData>& playerParty = playerCharacter->getPokemons();
+    std::vector<PokeData>& npcParty = nonPlayerCharacter->getPokemons();
+    if (!playerParty.empty() && !npcParty.empty()) {
+        BattleState state;
+        PokeData* members[2][BATTLE_MAX_TEAM];
+        fillBattleSide(state.sides[0], playerCharacter, &playerParty[0], members[0]);
+        fillBattleSide(state.sides[1], nonPlayerCharacter, &npcParty[0], members[1]);
+        state.turn = 0;
+        state.rng = RngStream(rngStream(rng_battle).next());
+        GreedyMovePolicy greedy;
+        runBattle(state, greedy, greedy, 200);
+        storeBattleState(state, members);
+        // Whoever the player has on the field at the end takes the experience
+        PokeData* winner = members[0][state.sides[0].active];
+        for (int i = 0; i < state.sides[1].teamSize && winner->getHP() > 0; i++) {
+            if (state.sides[1].team[i].fainted()) {
+                gainExperience(*winner, battleExperience(*members[1][i]));
+            }
+        }
+    }
 
+    nonPlayerCharacter->defeated = 1;
+    if (nonPlayerCharacter->ctype == char_hiker || nonPlayerCharacter->ctype == char_rival) {
+        nonPlayerCharacter->mtype = move_wander;
+    }
 }
 
 //for when the player chooses to use a move
 void processMove(pc* playerCharacter, PokeData* playerPokemon, npc* nonPlayerCharacter, PokeData* nonPlayerPokemon, const Moves* playerMove){
-    
-        // Choose a move for the NPC (randomly from their move set in their PokeData)
-    const std::vector<Moves>& npcMoves = nonPlayerPokemon->getMovesList();
-    const Moves* npcMove = &npcMoves[rand() % npcMoves.size()];
-
-    // Determine which move goes first by which has a higher priority
-    bool playerGoesFirst = playerMove->getPriority() >= npcMove->getPriority();
-
-    // Placeholder variables for damage and critical hit flags
-    int npcDamage = 0, playerDamage = 0;
-    bool pcCrit = false, npcCrit = false, npcHit = false, pcHit = false;
-
-    // Process the moves based on priority
-    if (playerGoesFirst) {
-        // Process the player's move
-        pcHit = playerMove->getAccuracy() == -1 || (rand() % 100) <= playerMove->getAccuracy();
-        if (pcHit) {
-            pcCrit = isCritical();
-            playerDamage = processMoveDamage(playerPokemon, playerMove, pcCrit);
-            applyDamage(nonPlayerPokemon, playerDamage);
-        }
-        // Check if the NPC's Pokemon has fainted
-        if (!isFainted(nonPlayerPokemon)) {
-            // Process the NPC's move
-            npcHit = (rand() % 100) <= npcMove->getAccuracy();
-            if (npcHit) {
-                npcCrit = isCritical();
-                npcDamage = processMoveDamage(nonPlayerPokemon, npcMove, npcCrit);
-                applyDamage(playerPokemon, npcDamage);
-            }
-        }
-    } else {
-        // Process the NPC's move
-         npcHit = npcMove->getAccuracy() == -1 || (rand() % 100) <= npcMove->getAccuracy();
-        if (npcHit) {
-            npcCrit = isCritical();
-            npcDamage = processMoveDamage(nonPlayerPokemon, npcMove, npcCrit);
-            applyDamage(playerPokemon, npcDamage);
-        }
-        // Check if the player's Pokemon has fainted
-        if (!isFainted(playerPokemon)) {
-            // Process the player's move
-            pcHit = (rand() % 100) <= playerMove->getAccuracy();
-            if (pcHit) {
-                pcCrit = isCritical();
-                playerDamage = processMoveDamage(playerPokemon, playerMove, pcCrit);
-                applyDamage(nonPlayerPokemon, playerDamage);
-            }
+    // The engine refers to moves by slot
+    BattleAction playerAction = { action_pass, 0 };
+    for (size_t i = 0; i < playerPokemon->getMoveCount() && i < BATTLE_MAX_MOVES; i++) {
+        if (playerPokemon->getMoveSlot(i).moveId == playerMove->getId()) {
+            playerAction = { action_move, (int) i };
+            break;
         }
     }
 
-    io_display_move_results(playerMove, npcMove, npcDamage, playerDamage, pcCrit, npcCrit, npcHit, pcHit);
+    TurnResult result = playBattleTurn(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon, playerAction);
+    const MoveOutcome& pcOutcome = result.outcome[0];
+    const MoveOutcome& npcOutcome = result.outcome[1];
+    io_display_move_results(pcOutcome.move, npcOutcome.move, npcOutcome.damage, pcOutcome.damage, pcOutcome.crit, npcOutcome.crit, npcOutcome.hit, pcOutcome.hit);
 }
 
 void processNPCMovePotion(pc* playerCharacter, PokeData* playerPokemon, npc* nonPlayerCharacter, PokeData* nonPlayerPokemon, int healthRegen){
-        // Choose a move for the NPC (randomly from their move set in their PokeData)
-    const std::vector<Moves>& npcMoves = nonPlayerPokemon->getMovesList();
-    const Moves* npcMove = &npcMoves[rand() % npcMoves.size()];
-    // Placeholder variables for damage and critical hit flags
-    int npcDamage = 0;
-    bool npcCrit = false, npcHit = false;
-
-     // Process the NPC's move
-         npcHit = npcMove->getAccuracy() == -1 || (rand() % 100) <= npcMove->getAccuracy();
-        if (npcHit) {
-            npcCrit = isCritical();
-            npcDamage = processMoveDamage(nonPlayerPokemon, npcMove, npcCrit);
-            applyDamage(playerPokemon, npcDamage);
-        }
-      
-
-    io_display_potion_results(healthRegen, npcMove, npcDamage, npcCrit, npcHit);
+    const MoveOutcome npcOutcome = playBattleTurn(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon, { action_pass, 0 }).outcome[1];
+    io_display_potion_results(healthRegen, npcOutcome.move, npcOutcome.damage, npcOutcome.crit, npcOutcome.hit);
 }
 
 void processNPCMoveRevive(pc* playerCharacter, PokeData* playerPokemon, npc* nonPlayerCharacter, PokeData* nonPlayerPokemon){
-        // Choose a move for the NPC (randomly from their move set in their PokeData)
-    const std::vector<Moves>& npcMoves = nonPlayerPokemon->getMovesList();
-    const Moves* npcMove = &npcMoves[rand() % npcMoves.size()];
-    // Placeholder variables for damage and critical hit flags
-    int npcDamage = 0;
-    bool npcCrit = false, npcHit = false;
-
-     // Process the NPC's move
-         npcHit = npcMove->getAccuracy() == -1 || (rand() % 100) <= npcMove->getAccuracy();
-        if (npcHit) {
-            npcCrit = isCritical();
-            npcDamage = processMoveDamage(nonPlayerPokemon, npcMove, npcCrit);
-            applyDamage(playerPokemon, npcDamage);
-        }
-      
-
-    io_display_revive_results(npcMove, npcDamage, npcCrit, npcHit);
+    const MoveOutcome npcOutcome = playBattleTurn(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon, { action_pass, 0 }).outcome[1];
+    io_display_revive_results(npcOutcome.move, npcOutcome.damage, npcOutcome.crit, npcOutcome.hit);
 }
 
 void processNPCMoveSwitch(pc* playerCharacter, PokeData* playerPokemon, npc* nonPlayerCharacter, PokeData* nonPlayerPokemon){
-        // Choose a move for the NPC (randomly from their move set in their PokeData)
-    const std::vector<Moves>& npcMoves = nonPlayerPokemon->getMovesList();
-    const Moves* npcMove = &npcMoves[rand() % npcMoves.size()];
-    // Placeholder variables for damage and critical hit flags
-    int npcDamage = 0;
-    bool npcCrit = false, npcHit = false;
-
-     // Process the NPC's move
-         npcHit = npcMove->getAccuracy() == -1 || (rand() % 100) <= npcMove->getAccuracy();
-        if (npcHit) {
-            npcCrit = isCritical();
-            npcDamage = processMoveDamage(nonPlayerPokemon, npcMove, npcCrit);
-            applyDamage(playerPokemon, npcDamage);
-        }
-      
-
-    io_display_switch_results(npcMove, npcDamage, npcCrit, npcHit);
+    const MoveOutcome npcOutcome = playBattleTurn(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon, { action_pass, 0 }).outcome[1];
+    io_display_switch_results(npcOutcome.move, npcOutcome.damage, npcOutcome.crit, npcOutcome.hit);
 }
 
 void usePokeBall(character* player, PokeData* nonPlayerPokemon){
@@ -254,41 +202,23 @@ int usePotion(pc* playerCharacter, PokeData* playerPokemon, Potion* potion){
         return 0; // Invalid parameters, no potion used
     }
 
-    auto findHP = [](std::vector<PokeStats>& stats) -> PokeStats* {
-        for (auto& stat : stats) {
-            if (stat.getStatIdentifier() == "hp") {
-                return &stat;
-            }
-        }
-        return nullptr; // HP stat not found
-    };
-
-    auto findMaxHP = [](const std::vector<PokeStats>& stats) -> const PokeStats* {
-        for (const auto& stat : stats) {
-            if (stat.getStatIdentifier() == "maxHP") {
-                return &stat;
-            }
-        }
-        return nullptr; // maxHP stat not found
-    };
-
     // Apply the potion's healing effect
-    PokeStats* hpStat = findHP(playerPokemon->getStatsList());
-    const PokeStats* maxHPStat = findMaxHP(playerPokemon->getStatsList());
-    if (hpStat && maxHPStat) {
-        int newHP = std::min(hpStat->getStatRating() + potion->getHealingAmount(), maxHPStat->getStatRating());
-        hpStat->setStatRating(newHP);
+    if (playerPokemon->hasStat(stat_hp) && playerPokemon->hasStat(stat_max_hp)) {
+        int newHP = std::min(playerPokemon->getHP() + potion->getHealingAmount(), playerPokemon->getMaxHP());
+        playerPokemon->setHP(newHP);
     }
 
-    // Find and remove the used potion from the character's potions list
+    // Find and remove the used potion from the character's potions list;
+    // once out of the list the character no longer owns it
+    int healed = potion->getHealingAmount();
     auto& potions = playerCharacter->getPotions();
     auto it = std::find(potions.begin(), potions.end(), potion);
     if (it != potions.end()) {
-        potions.erase(it); // Remove the pointer from the list
-        // Do not delete the potion here; let the character destructor handle it
+        potions.erase(it);
+        delete potion;
     }
 
-    return potion->getHealingAmount(); // Return the amount of health restored
+    return healed; // Return the amount of health restored
 }
 
 
@@ -0,0 +1,228 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "battle_ai.h"
+#include "threadpool.h"
+
+// One float per move slot, or per team member for roster scoring; GCC
+// lowers the arithmetic to SSE/NEON.  Vector widths must be powers of two,
+// so the team is padded to TEAM_LANES.
+#define TEAM_LANES 8
+typedef float MoveLanes __attribute__((vector_size(BATTLE_MAX_MOVES * sizeof(float))));
+typedef float TeamLanes __attribute__((vector_size(TEAM_LANES * sizeof(float))));
+static_assert(BATTLE_MAX_TEAM <= TEAM_LANES, "team does not fit in TeamLanes");
+
+// Mean of the 85-100% damage roll, and the expected critical multiplier
+// with one hit in 16 doing 1.5x
+static const float MEAN_ROLL = 0.925f;
+static const float MEAN_CRIT = 1.03125f;
+
+// Inputs of one move each, either across the slots of one attacker or
+// across the team for one slot
+template <typename Lanes>
+struct LaneInputs {
+    Lanes levelFactor; // 2 * level / 5 + 2 of the attacker
+    Lanes power;
+    Lanes ratio;     // attack / defense for the move's damage class
+    Lanes modifier;  // STAB x type effectiveness
+    Lanes hitChance; // 0..1
+    Lanes priority;
+    Lanes valid;     // 1 for a move, 0 for an empty slot
+};
+
+// Fills lane of in with move m of attacker
+template <typename Lanes>
+static void gatherMove(const BattleMon& attacker, const BattleMon& defender, int m, LaneInputs<Lanes>& in, int lane) {
+    const Moves& move = *attacker.moves[m];
+    int type = move.getTypeId();
+    bool stab = type == attacker.types[0] || type == attacker.types[1];
+    bool special = move.getDamageClass() == DAMAGE_CLASS_SPECIAL;
+    in.levelFactor[lane] = (2 * std::max(attacker.level, 1)) / 5 + 2;
+    in.power[lane] = move.getPower();
+    in.ratio[lane] = special
+        ? (float) std::max(attacker.stats[stat_special_attack], 1) / std::max(defender.stats[stat_special_defense], 1)
+        : (float) std::max(attacker.stats[stat_attack], 1) / std::max(defender.stats[stat_defense], 1);
+    in.modifier[lane] = (stab ? 1.5f : 1.0f) * typeEffectiveness(type, defender) / 100.0f;
+    in.hitChance[lane] = move.getAccuracy() == -1 ? 1.0f : move.getAccuracy() / 100.0f;
+    in.priority[lane] = move.getPriority();
+    in.valid[lane] = 1.0f;
+}
+
+// Written through score rather than returned: returning an 8-float vector
+// by value has a different ABI with and without AVX
+template <typename Lanes>
+static void scoreLanes(const LaneInputs<Lanes>& in, int defenderHp, Lanes& score) {
+    Lanes hp = Lanes{} + (float) std::max(defenderHp, 1);
+
+    // Same formula as computeDamage(), with the random parts replaced by
+    // their means
+    Lanes damage = (in.levelFactor * in.power * in.ratio / 50.0f + 2.0f) * (MEAN_ROLL * MEAN_CRIT) * in.modifier;
+    Lanes capped = damage < hp ? damage : hp;
+    score = capped * in.hitChance;
+    // Going first matters only when the hit can end it
+    score += damage >= hp ? in.priority * hp * 0.5f * in.hitChance : Lanes{};
+    score = in.valid != 0 ? score : Lanes{} - 1.0f;
+}
+
+void scoreMoves(const BattleMon& attacker, const BattleMon& defender, float scores[BATTLE_MAX_MOVES]) {
+    LaneInputs<MoveLanes> in = {};
+    for (int m = 0; m < attacker.numMoves; m++) {
+        if (attacker.canUse(m)) {
+            gatherMove(attacker, defender, m, in, m);
+        }
+    }
+    MoveLanes lanes;
+    scoreLanes(in, defender.hp, lanes);
+    for (int m = 0; m < BATTLE_MAX_MOVES; m++) {
+        scores[m] = lanes[m];
+    }
+}
+
+// Laid out [slot][member], so each pass scores one slot of the whole team
+void scoreRoster(const BattleSide& side, const BattleMon& defender, float scores[BATTLE_MAX_TEAM][BATTLE_MAX_MOVES]) {
+    LaneInputs<TeamLanes> in[BATTLE_MAX_MOVES] = {};
+    for (int i = 0; i < side.teamSize; i++) {
+        for (int m = 0; m < side.team[i].numMoves; m++) {
+            if (side.team[i].canUse(m)) {
+                gatherMove(side.team[i], defender, m, in[m], i);
+            }
+        }
+    }
+    for (int m = 0; m < BATTLE_MAX_MOVES; m++) {
+        TeamLanes lanes;
+        scoreLanes(in[m], defender.hp, lanes);
+        for (int i = 0; i < BATTLE_MAX_TEAM; i++) {
+            scores[i][m] = lanes[i];
+        }
+    }
+}
+
+int bestMove(const float scores[BATTLE_MAX_MOVES]) {
+    int best = -1;
+    for (int m = 0; m < BATTLE_MAX_MOVES; m++) {
+        if (scores[m] >= 0 && (best < 0 || scores[m] > scores[best])) {
+            best = m;
+        }
+    }
+    return best;
+}
+
+BattleAction GreedyMovePolicy::chooseAction(const BattleState& state, int side) {
+    float scores[BATTLE_MAX_MOVES];
+    scoreMoves(state.sides[side].current(), state.sides[1 - side].current(), scores);
+    int move = bestMove(scores);
+    return move < 0 ? BattleAction{ action_pass, 0 } : BattleAction{ action_move, move };
+}
+
+int GreedyMovePolicy::chooseReplacement(const BattleState& state, int side) {
+    const BattleSide& own = state.sides[side];
+    float scores[BATTLE_MAX_TEAM][BATTLE_MAX_MOVES];
+    scoreRoster(own, state.sides[1 - side].current(), scores);
+
+    int best = own.firstStanding();
+    float bestScore = -1;
+    for (int i = 0; i < own.teamSize; i++) {
+        int move = bestMove(scores[i]);
+        if (!own.team[i].fainted() && move >= 0 && scores[i][move] > bestScore) {
+            best = i;
+            bestScore = scores[i][move];
+        }
+    }
+    return best;
+}
+
+/*Monte Carlo lookahead*/
+double trainerLookaheadMs = 0;
+
+MonteCarloPolicy::MonteCarloPolicy(double budgetMs, bool allowSwitch, int maxTurns)
+    : budgetMs(budgetMs), allowSwitch(allowSwitch), maxTurns(maxTurns) {}
+
+// Every action worth trying for side this turn
+static std::vector<BattleAction> candidateActions(const BattleState& state, int side, bool allowSwitch) {
+    std::vector<BattleAction> actions;
+    const BattleSide& own = state.sides[side];
+    const BattleMon& mon = own.current();
+    for (int m = 0; m < mon.numMoves; m++) {
+        if (mon.canUse(m)) {
+            actions.push_back(BattleAction{ action_move, m });
+        }
+    }
+    if (mon.hp < mon.maxHp) {
+        for (int p = 0; p < own.numPotions; p++) {
+            // Potions of the same strength are interchangeable
+            if (std::find(own.potions, own.potions + p, own.potions[p]) == own.potions + p) {
+                actions.push_back(BattleAction{ action_potion, p });
+            }
+        }
+    }
+    if (allowSwitch) {
+        for (int i = 0; i < own.teamSize; i++) {
+            if (i != own.active && !own.team[i].fainted()) {
+                actions.push_back(BattleAction{ action_switch, i });
+            }
+        }
+    }
+    return actions;
+}
+
+BattleAction MonteCarloPolicy::chooseAction(const BattleState& state, int side) {
+    std::vector<BattleAction> actions = candidateActions(state, side, allowSwitch);
+    if (actions.empty()) {
+        return BattleAction{ action_pass, 0 };
+    }
+    if (actions.size() == 1) {
+        return actions[0];
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(budgetMs));
+
+    ThreadPool& pool = ThreadPool::shared();
+    size_t workers = pool.size();
+    // Playouts and wins (draws count half) per action, per worker
+    std::vector<std::vector<double>> wins(workers, std::vector<double>(actions.size(), 0));
+    std::vector<std::vector<int>> playouts(workers, std::vector<int>(actions.size(), 0));
+    std::atomic<uint64_t> nextPlayout{0};
+    int turnLimit = state.turn + maxTurns;
+
+    pool.parallelFor(workers, [&](size_t w) {
+        GreedyMovePolicy greedy;
+        // Every worker plays at least one round so a tiny budget still decides
+        do {
+            uint64_t n = nextPlayout.fetch_add(1);
+            size_t a = n % actions.size();
+            BattleState playout = state;
+            playout.rng = state.rng.split(n);
+
+            BattleAction own = actions[a];
+            BattleAction other = greedy.chooseAction(playout, 1 - side);
+            resolveTurn(playout, side == 0 ? own : other, side == 0 ? other : own);
+            int winner = runBattle(playout, greedy, greedy, turnLimit);
+
+            wins[w][a] += winner == side ? 1.0 : winner < 0 ? 0.5 : 0.0;
+            playouts[w][a]++;
+        } while (Clock::now() < deadline);
+    });
+
+    size_t best = 0;
+    double bestRate = -1;
+    for (size_t a = 0; a < actions.size(); a++) {
+        double total = 0;
+        int count = 0;
+        for (size_t w = 0; w < workers; w++) {
+            total += wins[w][a];
+            count += playouts[w][a];
+        }
+        double rate = count ? total / count : 0;
+        if (rate > bestRate) {
+            best = a;
+            bestRate = rate;
+        }
+    }
+    return actions[best];
+}
+
+int MonteCarloPolicy::chooseReplacement(const BattleState& state, int side) {
+    return GreedyMovePolicy().chooseReplacement(state, side);
+}
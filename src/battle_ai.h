@@ -0,0 +1,52 @@
+// battle_ai.h
+#ifndef BATTLE_AI_H
+#define BATTLE_AI_H
+
+#include "battle_engine.h"
+
+// Move evaluation for computer-controlled trainers.  Every move slot of a
+// Pokemon is scored in one pass: each input (power, attack/defense ratio,
+// STAB x matchup, hit chance, priority) is gathered into one vector lane
+// per slot, and the arithmetic then runs on whole vectors.  A whole team is
+// scored the same way with one lane per member, one move slot at a time.
+
+// Expected damage of each move against defender, capped at the defender's
+// HP, times its hit chance, plus a bonus for priority on moves that can
+// finish the defender.  Empty slots and moves out of PP score -1.
+void scoreMoves(const BattleMon& attacker, const BattleMon& defender, float scores[BATTLE_MAX_MOVES]);
+// scoreMoves() for every member of a team against one defender
+void scoreRoster(const BattleSide& side, const BattleMon& defender, float scores[BATTLE_MAX_TEAM][BATTLE_MAX_MOVES]);
+// Slot with the highest score, or -1 if every slot is empty
+int bestMove(const float scores[BATTLE_MAX_MOVES]);
+
+// Always uses the best-scoring move, and after a faint sends in the team
+// member with the best move against the opponent
+class GreedyMovePolicy : public BattlePolicy {
+public:
+    BattleAction chooseAction(const BattleState& state, int side) override;
+    int chooseReplacement(const BattleState& state, int side) override;
+};
+
+// Per-decision time budget of the Monte Carlo trainer AI in milliseconds;
+// 0 (the default) leaves trainers on GreedyMovePolicy
+extern double trainerLookaheadMs;
+
+// Tries every legal action (each move, each distinct potion and, if
+// allowed, each switch) by playing the rest of the battle out many times
+// from a copy of the state with greedy play on both sides, and picks the
+// action with the best win rate.  Playouts run on the shared thread pool
+// until the time budget is spent, so the choice is not reproducible.
+class MonteCarloPolicy : public BattlePolicy {
+private:
+    double budgetMs;
+    bool allowSwitch;
+    int maxTurns;
+
+public:
+    // maxTurns bounds each playout; unfinished playouts count as draws
+    explicit MonteCarloPolicy(double budgetMs, bool allowSwitch = true, int maxTurns = 100);
+    BattleAction chooseAction(const BattleState& state, int side) override;
+    int chooseReplacement(const BattleState& state, int side) override;
+};
+
+#endif // BATTLE_AI_H
@@ -0,0 +1,269 @@
+#include <algorithm>
+#include "battle_engine.h"
+#include "pokedex.h"
+
+/*BattleSide*/
+int BattleSide::firstStanding() const {
+    for (int i = 0; i < teamSize; i++) {
+        if (!team[i].fainted()) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*Policies*/
+int BattlePolicy::chooseReplacement(const BattleState& state, int side) {
+    return state.sides[side].firstStanding();
+}
+
+BattleAction RandomMovePolicy::chooseAction(const BattleState& state, int side) {
+    const BattleMon& mon = state.sides[side].current();
+    int usable = 0;
+    for (int m = 0; m < mon.numMoves; m++) {
+        usable += mon.canUse(m);
+    }
+    if (usable == 0) {
+        return BattleAction{ action_pass, 0 };
+    }
+    // The state is const, so draw from a substream keyed by turn and side
+    RngStream rng = state.rng.split(state.turn * 2 + side);
+    int pick = (int) rng.below(usable);
+    int m = 0;
+    while (!mon.canUse(m) || pick-- > 0) {
+        m++;
+    }
+    return BattleAction{ action_move, m };
+}
+
+/*Setup*/
+BattleMon makeBattleMon(const PokeData& pokemon) {
+    BattleMon mon;
+    mon.pokemonId = pokemon.getPokemon().getId();
+    mon.level = pokemon.getLevel();
+    for (int s = 0; s < num_stats; s++) {
+        mon.stats[s] = pokemon.getStat((stat_t) s);
+    }
+    mon.hp = pokemon.getHP();
+    mon.maxHp = pokemon.getMaxHP();
+
+    const PokemonTypesList* typesTable = pokedex.pokemonTypes();
+    TypePair types = typesTable ? typesTable->typesOf(mon.pokemonId) : TypePair{ { 0, 0 } };
+    mon.types[0] = types.type[0];
+    mon.types[1] = types.type[1];
+
+    mon.numMoves = 0;
+    const MovesList* movesTable = pokedex.moves();
+    for (size_t i = 0; i < pokemon.getMoveCount(); i++) {
+        if (mon.numMoves == BATTLE_MAX_MOVES) {
+            break;
+        }
+        const Moves* row = movesTable ? movesTable->findById(pokemon.getMoveSlot(i).moveId) : nullptr;
+        if (row) {
+            int pp = pokemon.getPp(i);
+            mon.pp[mon.numMoves] = pp == MOVE_PP_UNLIMITED ? -1 : pp;
+            mon.moves[mon.numMoves++] = row;
+        }
+    }
+    return mon;
+}
+
+void storeBattleMon(const BattleMon& mon, PokeData& pokemon) {
+    if (pokemon.hasStat(stat_hp)) {
+        pokemon.setHP(mon.hp);
+    }
+    // Slots whose move is missing from the catalog were skipped on the
+    // way in, so match by move id rather than index
+    for (int m = 0; m < mon.numMoves; m++) {
+        for (size_t i = 0; i < pokemon.getMoveCount(); i++) {
+            if (pokemon.getMoveSlot(i).moveId == mon.moves[m]->getId()) {
+                if (mon.pp[m] >= 0) {
+                    pokemon.setPp(i, mon.pp[m]);
+                }
+                break;
+            }
+        }
+    }
+}
+
+static void fillSide(BattleSide& side, const std::vector<PokeData>& party) {
+    side.teamSize = 0;
+    for (const PokeData& pokemon : party) {
+        if (side.teamSize == BATTLE_MAX_TEAM) {
+            break;
+        }
+        side.team[side.teamSize++] = makeBattleMon(pokemon);
+    }
+    side.active = std::max(side.firstStanding(), 0);
+    side.numPotions = 0;
+}
+
+BattleState makeBattle(const std::vector<PokeData>& player, const std::vector<PokeData>& opponent, uint32_t seed) {
+    BattleState state;
+    fillSide(state.sides[0], player);
+    fillSide(state.sides[1], opponent);
+    state.turn = 0;
+    state.rng = RngStream(RngStream::mix(seed));
+    return state;
+}
+
+BattleState makeDuel(const PokeData& player, const PokeData& opponent, uint32_t seed) {
+    return makeDuel(makeBattleMon(player), makeBattleMon(opponent), RngStream(RngStream::mix(seed)));
+}
+
+BattleState makeDuel(const BattleMon& player, const BattleMon& opponent, const RngStream& rng) {
+    BattleState state;
+    const BattleMon* mons[2] = { &player, &opponent };
+    for (int side = 0; side < 2; side++) {
+        state.sides[side].team[0] = *mons[side];
+        state.sides[side].teamSize = 1;
+        state.sides[side].active = 0;
+        state.sides[side].numPotions = 0;
+    }
+    state.turn = 0;
+    state.rng = rng;
+    return state;
+}
+
+/*Turn resolution*/
+// One hit in 16 is critical
+static bool isCritical(RngStream& rng) {
+    return rng.below(16) == 0;
+}
+
+int typeEffectiveness(int moveType, const BattleMon& defender) {
+    // The matchup chart is fixed once loaded; without type_efficacy.csv
+    // every matchup is neutral
+    static const TypeEfficacyList* chart = pokedex.typeEfficacy();
+    if (!chart) {
+        return 100;
+    }
+    int percent = 100;
+    for (int slot = 0; slot < 2; slot++) {
+        if (defender.types[slot]) {
+            percent = percent * chart->factor(moveType, defender.types[slot]) / 100;
+        }
+    }
+    return percent;
+}
+
+int computeDamage(const BattleMon& attacker, const BattleMon& defender, const Moves& move, bool crit, RngStream& rng) {
+    int effectiveness = typeEffectiveness(move.getTypeId(), defender);
+    if (effectiveness == 0) {
+        return 0; // immune
+    }
+
+    bool special = move.getDamageClass() == DAMAGE_CLASS_SPECIAL;
+    int attack = attacker.stats[special ? stat_special_attack : stat_attack];
+    int defense = defender.stats[special ? stat_special_defense : stat_defense];
+    int level = std::max(attacker.level, 1);
+
+    //((2*level)/5 + 2) * power * (attack/defense) / 50 + 2
+    int64_t damage = (int64_t) ((2 * level) / 5 + 2) * move.getPower() * std::max(attack, 1) / std::max(defense, 1) / 50 + 2;
+    damage = damage * rng.range(85, 100) / 100;
+    if (crit) {
+        damage = damage * 3 / 2;
+    }
+    int moveType = move.getTypeId();
+    if (moveType == attacker.types[0] || moveType == attacker.types[1]) {
+        damage = damage * 3 / 2; // same-type attack bonus
+    }
+    damage = damage * effectiveness / 100;
+    return (int) std::min<int64_t>(std::max<int64_t>(damage, 1), INT_MAX);
+}
+
+// Accuracy -1 marks moves that cannot miss
+static bool rollHit(const Moves& move, RngStream& rng) {
+    return move.getAccuracy() == -1 || rng.chance(move.getAccuracy());
+}
+
+static void useMove(BattleState& state, int side, const BattleAction& action, MoveOutcome& outcome) {
+    BattleMon& attacker = state.sides[side].current();
+    BattleMon& defender = state.sides[1 - side].current();
+    if (action.type != action_move || action.index < 0 || action.index >= attacker.numMoves || attacker.fainted() ||
+        !attacker.canUse(action.index)) {
+        return;
+    }
+    if (attacker.pp[action.index] > 0) {
+        attacker.pp[action.index]--;
+    }
+    const Moves& move = *attacker.moves[action.index];
+    outcome.move = &move;
+    outcome.hit = rollHit(move, state.rng);
+    if (outcome.hit) {
+        outcome.crit = isCritical(state.rng);
+        outcome.damage = computeDamage(attacker, defender, move, outcome.crit, state.rng);
+        defender.hp = std::max(0, defender.hp - outcome.damage);
+    }
+}
+
+static int priorityOf(const BattleState& state, int side, const BattleAction& action) {
+    const BattleMon& mon = state.sides[side].current();
+    if (action.type != action_move || action.index < 0 || action.index >= mon.numMoves) {
+        return 0;
+    }
+    return mon.moves[action.index]->getPriority();
+}
+
+TurnResult resolveTurn(BattleState& state, const BattleAction& action0, const BattleAction& action1) {
+    TurnResult result = {};
+    const BattleAction* actions[2] = { &action0, &action1 };
+
+    for (int side = 0; side < 2; side++) {
+        const BattleAction& action = *actions[side];
+        BattleSide& s = state.sides[side];
+        if (action.type == action_switch && action.index >= 0 && action.index < s.teamSize && !s.team[action.index].fainted()) {
+            s.active = action.index;
+        } else if (action.type == action_potion && action.index >= 0 && action.index < s.numPotions && !s.current().fainted()) {
+            BattleMon& mon = s.current();
+            int hp = std::min(mon.maxHp, mon.hp + s.potions[action.index]);
+            result.healed[side] = hp - mon.hp;
+            mon.hp = hp;
+            std::copy(s.potions + action.index + 1, s.potions + s.numPotions, s.potions + action.index);
+            s.numPotions--;
+        }
+    }
+
+    result.first = priorityOf(state, 0, action0) >= priorityOf(state, 1, action1) ? 0 : 1;
+    useMove(state, result.first, *actions[result.first], result.outcome[result.first]);
+    int second = 1 - result.first;
+    useMove(state, second, *actions[second], result.outcome[second]);
+
+    state.turn++;
+    return result;
+}
+
+int battleLoser(const BattleState& state) {
+    for (int side = 0; side < 2; side++) {
+        if (state.sides[side].firstStanding() < 0) {
+            return side;
+        }
+    }
+    return -1;
+}
+
+int runBattle(BattleState& state, BattlePolicy& policy0, BattlePolicy& policy1, int maxTurns) {
+    BattlePolicy* policies[2] = { &policy0, &policy1 };
+    while (state.turn < maxTurns) {
+        int loser = battleLoser(state);
+        if (loser >= 0) {
+            return 1 - loser;
+        }
+        for (int side = 0; side < 2; side++) {
+            BattleSide& s = state.sides[side];
+            if (s.current().fainted()) {
+                int next = policies[side]->chooseReplacement(state, side);
+                if (next >= 0 && next < s.teamSize && !s.team[next].fainted()) {
+                    s.active = next;
+                } else {
+                    s.active = s.firstStanding();
+                }
+            }
+        }
+        BattleAction action0 = policy0.chooseAction(state, 0);
+        BattleAction action1 = policy1.chooseAction(state, 1);
+        resolveTurn(state, action0, action1);
+    }
+    int loser = battleLoser(state);
+    return loser >= 0 ? 1 - loser : -1;
+}
@@ -0,0 +1,139 @@
+// battle_engine.h
+#ifndef BATTLE_ENGINE_H
+#define BATTLE_ENGINE_H
+
+#include <cstdint>
+#include <vector>
+#include "data.h"
+#include "prints.h"
+#include "rng.h"
+
+// Headless battle simulation.  Nothing in here touches the screen or the
+// keyboard: a BattleState is advanced one turn at a time by resolveTurn()
+// (or to completion by runBattle()), with each side's decisions supplied
+// by a BattlePolicy.  io.cpp is just one front end on top of this.
+
+#define BATTLE_MAX_TEAM 6
+#define BATTLE_MAX_MOVES 4
+#define BATTLE_MAX_POTIONS 8
+
+// One Pokemon as the engine sees it: plain values only, so whole battle
+// states can be copied freely
+struct BattleMon {
+    int pokemonId;
+    int level;
+    int hp;
+    int maxHp;
+    int stats[num_stats];
+    int types[2]; // type ids by slot, 0 for none
+    int numMoves;
+    const Moves* moves[BATTLE_MAX_MOVES]; // rows of the resident moves table
+    int pp[BATTLE_MAX_MOVES];             // PP left, -1 for moves that never run out
+
+    bool fainted() const { return hp <= 0; }
+    bool canUse(int move) const { return pp[move] != 0; }
+};
+
+struct BattleSide {
+    BattleMon team[BATTLE_MAX_TEAM];
+    int teamSize;
+    int active; // index into team
+    int potions[BATTLE_MAX_POTIONS]; // healing amount of each potion in the bag
+    int numPotions;
+
+    BattleMon& current() { return team[active]; }
+    const BattleMon& current() const { return team[active]; }
+    // Index of the first Pokemon still standing, or -1
+    int firstStanding() const;
+};
+
+// Side 0 is the player (or the first policy), side 1 the opponent
+struct BattleState {
+    BattleSide sides[2];
+    int turn;
+    RngStream rng;
+};
+
+typedef enum battle_action_type {
+    action_move,   // use moves[index] of the active Pokemon
+    action_switch, // bring in team[index]; takes the side's turn
+    action_potion, // drink potions[index] on the active Pokemon
+    action_pass    // the side acted outside the engine (item, etc.)
+} battle_action_type_t;
+
+struct BattleAction {
+    battle_action_type_t type;
+    int index;
+};
+
+// What one side's move did during a turn
+struct MoveOutcome {
+    const Moves* move; // nullptr if the side did not attack
+    bool hit;
+    bool crit;
+    int damage;
+};
+
+struct TurnResult {
+    MoveOutcome outcome[2]; // by side
+    int healed[2];          // HP restored by a potion, by side
+    int first;              // side that acted first
+};
+
+// Chooses actions for one side of a battle
+class BattlePolicy {
+public:
+    virtual ~BattlePolicy() {}
+    virtual BattleAction chooseAction(const BattleState& state, int side) = 0;
+    // Team index to send in after the active Pokemon fainted
+    virtual int chooseReplacement(const BattleState& state, int side);
+};
+
+// Picks a uniformly random move with PP left each turn (the classic NPC
+// behaviour)
+class RandomMovePolicy : public BattlePolicy {
+public:
+    BattleAction chooseAction(const BattleState& state, int side) override;
+};
+
+// Convert a PokeData into its battle form, resolving moves to catalog rows
+BattleMon makeBattleMon(const PokeData& pokemon);
+// Copy HP and PP left from a battle form back into its PokeData
+void storeBattleMon(const BattleMon& mon, PokeData& pokemon);
+
+// Build a battle between two parties (at most BATTLE_MAX_TEAM each).  The
+// first standing Pokemon of each side leads.
+BattleState makeBattle(const std::vector<PokeData>& player, const std::vector<PokeData>& opponent, uint32_t seed);
+// Build a one-on-one battle between two Pokemon
+BattleState makeDuel(const PokeData& player, const PokeData& opponent, uint32_t seed);
+// The same from Pokemon already in battle form, drawing from rng
+BattleState makeDuel(const BattleMon& player, const BattleMon& opponent, const RngStream& rng);
+
+// moves.csv damage_class_id of special moves (1 is status, 2 physical)
+#define DAMAGE_CLASS_SPECIAL 3
+
+// Combined matchup of a move type against both of the defender's types, as
+// a percentage (0 for immune up to 400); 100 without type_efficacy.csv
+int typeEffectiveness(int moveType, const BattleMon& defender);
+
+// Damage one move does: the standard formula over level, attack against
+// defense (physical or special by the move's damage class), a random
+// 85-100% roll, then critical (1.5x), same-type (1.5x) and type matchup
+// multipliers.  A move the defender is immune to does nothing.
+int computeDamage(const BattleMon& attacker, const BattleMon& defender, const Moves& move, bool crit, RngStream& rng);
+
+// Resolve both sides' actions for one turn.  Switches and potions go
+// first (a used potion leaves the bag, later ones move down), then
+// moves in priority order (side 0 wins ties); a Pokemon that faints
+// before acting, or picks a move with no PP left, does nothing.  Each
+// move used costs one PP, hit or miss.
+TurnResult resolveTurn(BattleState& state, const BattleAction& action0, const BattleAction& action1);
+
+// Side whose whole team has fainted, or -1 while both can still fight
+int battleLoser(const BattleState& state);
+
+// Play until one side is out of Pokemon or maxTurns pass.  Returns the
+// winning side, or -1 on a draw.
+int runBattle(BattleState& state, BattlePolicy& policy0, BattlePolicy& policy1, int maxTurns);
+
+#endif // BATTLE_ENGINE_H
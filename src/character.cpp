@@ -1,8 +1,12 @@
 #include <limits.h>
+#include <stdlib.h>
+#include <algorithm>
 
 #include "character.h"
 #include "poke_main.h"
 #include "io.h"
+#include "path_queue.h"
+#include "threadpool.h"
 
 /* Just to make the following table fit in 80 columns */
 #define PM DIJKSTRA_PATH_MAX
@@ -11,7 +15,7 @@
  * is governed by the swimmer movement code.  However, paths over   *
  * or adjacent to water are bridges.  They can't have inifinite     *
  * movement cost, or it throws a wrench into the turn queue.        */
-int32_t move_cost[num_character_types][num_terrain_types] = {
+extern constexpr int32_t move_cost[num_character_types][num_terrain_types] = {
 //  boulder,tree,path,mart,center,grass,clearing,mountain,forest,water,gate,bly
   { PM, PM, 10, 10, 10, 20, 10, PM, PM, PM, 10, 10 },
   { PM, PM, 10, NN, NN, 15, 10, 15, 15, PM, PM, NN },
@@ -125,81 +129,57 @@ uint32_t can_see(map *m, character *voyeur, character *exhibitionist)
   return 1;
 }
 
-static void move_hiker_func(character *c, pair_t dest)
+/* Hikers and rivals step to the free neighbor nearest the PC down     *
+ * world.dist, trying the directions from a random one onward.  With   *
+ * last_tie, the last of equally near neighbors wins (so a hiker will  *
+ * even step onto a cell it cannot reach the PC from); otherwise the   *
+ * first, and only a nearer one replaces it.  Next to the PC a battle  *
+ * starts, and the NPC moves only as far as its search had got.  The   *
+ * type is a template parameter so each instantiation reads its own    *
+ * move_cost row as a compile-time table, like distance_map below.     */
+template <character_type_t ctype, bool last_tie>
+static void move_chaser_func(character *c, pair_t dest)
 {
+  int (*dist)[MAP_X] = world.dist[ctype];
+  int32_t x, y, nx, ny;
   int min;
   int base;
   int i;
-  
-  base = rand() & 0x7;
 
-  dest[dim_x] = c->pos[dim_x];
-  dest[dim_y] = c->pos[dim_y];
+  base = rngStream(rng_trainer).next() & 0x7;
+
+  x = c->pos[dim_x];
+  y = c->pos[dim_y];
+  dest[dim_x] = x;
+  dest[dim_y] = y;
   min = DIJKSTRA_PATH_MAX;
-  
+
   for (i = base; i < 8 + base; i++) {
-    if ((world.hiker_dist[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                         [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] <= min) &&
-        !world.cur_map->cmap[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                            [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] &&
-        c->pos[dim_x] + all_dirs[i & 0x7][dim_x] != 0 &&
-        c->pos[dim_x] + all_dirs[i & 0x7][dim_x] != MAP_X - 1 &&
-        c->pos[dim_y] + all_dirs[i & 0x7][dim_y] != 0 &&
-        c->pos[dim_y] + all_dirs[i & 0x7][dim_y] != MAP_Y - 1 &&
-        move_cost[char_hiker][world.cur_map->map[c->pos[dim_y] +
-                                                 all_dirs[i & 0x7][dim_y]]
-                                                [c->pos[dim_x] +
-                                                 all_dirs[i & 0x7][dim_x]]] <
-          NO_NPCS) {
-      dest[dim_x] = c->pos[dim_x] + all_dirs[i & 0x7][dim_x];
-      dest[dim_y] = c->pos[dim_y] + all_dirs[i & 0x7][dim_y];
-      min = world.hiker_dist[dest[dim_y]][dest[dim_x]];
+    nx = x + all_dirs[i & 0x7][dim_x];
+    ny = y + all_dirs[i & 0x7][dim_y];
+    if ((last_tie ? dist[ny][nx] <= min : dist[ny][nx] < min) &&
+        !world.cur_map->cmap[ny][nx] &&
+        nx != 0 && nx != MAP_X - 1 && ny != 0 && ny != MAP_Y - 1 &&
+        move_cost[ctype][world.cur_map->map[ny][nx]] < NO_NPCS) {
+      dest[dim_x] = nx;
+      dest[dim_y] = ny;
+      min = dist[ny][nx];
     }
-    if (world.hiker_dist[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                        [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] == 0) {
+    if (!dist[ny][nx]) {
       io_battle(c, &world.pc);
       break;
     }
   }
 }
 
-static void move_rival_func(character *c, pair_t dest)
+static void move_hiker_func(character *c, pair_t dest)
 {
-  int min;
-  int base;
-  int i;
-  
-  base = rand() & 0x7;
+  move_chaser_func<char_hiker, true>(c, dest);
+}
 
-  dest[dim_x] = c->pos[dim_x];
-  dest[dim_y] = c->pos[dim_y];
-  min = DIJKSTRA_PATH_MAX;
-  
-  for (i = base; i < 8 + base; i++) {
-    if ((world.rival_dist[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                         [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] <
-         min) &&
-        !world.cur_map->cmap[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                            [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] &&
-        c->pos[dim_x] + all_dirs[i & 0x7][dim_x] != 0 &&
-        c->pos[dim_x] + all_dirs[i & 0x7][dim_x] != MAP_X - 1 &&
-        c->pos[dim_y] + all_dirs[i & 0x7][dim_y] != 0 &&
-        c->pos[dim_y] + all_dirs[i & 0x7][dim_y] != MAP_Y - 1 &&
-        move_cost[char_rival][world.cur_map->map[c->pos[dim_y] +
-                                                 all_dirs[i & 0x7][dim_y]]
-                                                [c->pos[dim_x] +
-                                                 all_dirs[i & 0x7][dim_x]]] <
-        NO_NPCS) {
-      dest[dim_x] = c->pos[dim_x] + all_dirs[i & 0x7][dim_x];
-      dest[dim_y] = c->pos[dim_y] + all_dirs[i & 0x7][dim_y];
-      min = world.rival_dist[dest[dim_y]][dest[dim_x]];
-    }
-    if (world.rival_dist[c->pos[dim_y] + all_dirs[i & 0x7][dim_y]]
-                        [c->pos[dim_x] + all_dirs[i & 0x7][dim_x]] == 0) {
-      io_battle(c, &world.pc);
-      break;
-    }
-  }
+static void move_rival_func(character *c, pair_t dest)
+{
+  move_chaser_func<char_rival, false>(c, dest);
 }
 
 static void move_pacer_func(character *c, pair_t dest)
@@ -447,236 +427,212 @@ void delete_character(void *v)
 
 #define ter_cost(x, y, c) move_cost[c][m->map[y][x]]
 
-static int32_t hiker_cmp(const void *key, const void *with) {
-  return (world.hiker_dist[((path_t *) key)->pos[dim_y]]
-                          [((path_t *) key)->pos[dim_x]] -
-          world.hiker_dist[((path_t *) with)->pos[dim_y]]
-                          [((path_t *) with)->pos[dim_x]]);
-}
-
-static int32_t rival_cmp(const void *key, const void *with) {
-  return (world.rival_dist[((path_t *) key)->pos[dim_y]]
-                          [((path_t *) key)->pos[dim_x]] -
-          world.rival_dist[((path_t *) with)->pos[dim_y]]
-                          [((path_t *) with)->pos[dim_x]]);
-}
+/* Distance maps.  world.dist[t] holds, for every cell, the cheapest  *
+ * way for a type t character to walk from there to the PC, paying the *
+ * move_cost of each cell it leaves.  The character type is a template *
+ * parameter, so each instantiation reads its own move_cost row as a   *
+ * compile-time table and no type needs its own hand-written loop.     */
+
+/* One queue per type, so different types' maps can be worked on at  *
+ * the same time; every finite move_cost fits the ring                 */
+static dial_queue pathfind_queues[num_character_types];
+static_assert(NO_NPCS < DIAL_BUCKETS, "move costs must fit the bucket ring");
+
+template <character_type_t ctype>
+struct distance_map {
+  /* Settle the map outward from the cells already in q.  Only interior *
+   * cells ctype can enter are ever improved.                           */
+  template <class queue>
+  static void relax(map *m, queue &q)
+  {
+    int (*dist)[MAP_X] = world.dist[ctype];
+    int cell, i;
+    int32_t x, y, nx, ny, d;
+
+    while ((cell = q.pop()) >= 0) {
+      y = cell / MAP_X;
+      x = cell % MAP_X;
+      d = dist[y][x] + ter_cost(x, y, ctype);
+      for (i = 0; i < 8; i++) {
+        ny = y + all_dirs[i][dim_y];
+        nx = x + all_dirs[i][dim_x];
+        if (ny < 1 || ny > MAP_Y - 2 || nx < 1 || nx > MAP_X - 2 ||
+            ter_cost(nx, ny, ctype) == DIJKSTRA_PATH_MAX ||
+            dist[ny][nx] <= d) {
+          continue;
+        }
+        dist[ny][nx] = d;
+        q.push(path_cell(nx, ny), d);
+      }
+    }
+  }
 
-void pathfind(map *m)
-{
-  heap_t h;
-  uint32_t x, y;
-  static path_t p[MAP_Y][MAP_X], *c;
-  static uint32_t initialized = 0;
+  /* From scratch */
+  template <class queue>
+  static void build(map *m, pair_t source, queue &q)
+  {
+    int (*dist)[MAP_X] = world.dist[ctype];
+    uint32_t x, y;
 
-  if (!initialized) {
-    initialized = 1;
     for (y = 0; y < MAP_Y; y++) {
       for (x = 0; x < MAP_X; x++) {
-        p[y][x].pos[dim_y] = y;
-        p[y][x].pos[dim_x] = x;
+        dist[y][x] = DIJKSTRA_PATH_MAX;
       }
     }
-  }
+    dist[source[dim_y]][source[dim_x]] = 0;
 
-  for (y = 0; y < MAP_Y; y++) {
-    for (x = 0; x < MAP_X; x++) {
-      world.hiker_dist[y][x] = world.rival_dist[y][x] = DIJKSTRA_PATH_MAX;
+    /* A source ctype cannot stand on leads nowhere */
+    q.clear();
+    if (ter_cost(source[dim_x], source[dim_y], ctype) != DIJKSTRA_PATH_MAX) {
+      q.push(path_cell(source[dim_x], source[dim_y]), 0);
     }
+    relax(m, q);
   }
-  world.hiker_dist[world.pc.pos[dim_y]][world.pc.pos[dim_x]] = 
-    world.rival_dist[world.pc.pos[dim_y]][world.pc.pos[dim_x]] = 0;
 
-  heap_init(&h, hiker_cmp, NULL);
+  static void build(map *m, pair_t source)
+  {
+    build(m, source, pathfind_queues[ctype]);
+  }
 
-  for (y = 1; y < MAP_Y - 1; y++) {
-    for (x = 1; x < MAP_X - 1; x++) {
-      if (ter_cost(x, y, char_hiker) != DIJKSTRA_PATH_MAX) {
-        p[y][x].hn = heap_insert(&h, &p[y][x]);
-      } else {
-        p[y][x].hn = NULL;
+  /* Whether repair() can move the source from `from` to `to`: they    *
+   * must be neighbors, and both cells ones the map routes through     */
+  static int can_repair(map *m, pair_t from, pair_t to)
+  {
+    return (abs(to[dim_x] - from[dim_x]) <= 1 &&
+            abs(to[dim_y] - from[dim_y]) <= 1 &&
+            ter_cost(from[dim_x], from[dim_y], ctype) != DIJKSTRA_PATH_MAX &&
+            ter_cost(to[dim_x], to[dim_y], ctype) != DIJKSTRA_PATH_MAX);
+  }
+
+  /* Move the source to the neighboring cell `to`.  Every path from `to` *
+   * can go through the old source first, so the old map plus that one  *
+   * step is an upper bound everywhere; only cells that get closer than *
+   * that are relaxed again, starting from `to`.                        */
+  static void repair(map *m, pair_t to)
+  {
+    int (*dist)[MAP_X] = world.dist[ctype];
+    uint32_t x, y;
+    int32_t step;
+
+    step = ter_cost(to[dim_x], to[dim_y], ctype);
+    for (y = 0; y < MAP_Y; y++) {
+      for (x = 0; x < MAP_X; x++) {
+        if (dist[y][x] != DIJKSTRA_PATH_MAX) {
+          dist[y][x] = std::min(dist[y][x] + step, DIJKSTRA_PATH_MAX);
+        }
       }
     }
+    dist[to[dim_y]][to[dim_x]] = 0;
+
+    pathfind_queues[ctype].clear();
+    pathfind_queues[ctype].push(path_cell(to[dim_x], to[dim_y]), 0);
+    relax(m, pathfind_queues[ctype]);
   }
+};
 
-  while ((c = (path_t *) heap_remove_min(&h))) {
-    c->hn = NULL;
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x] - 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x] - 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x] - 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x]    ].hn) &&
-        (world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x]    ] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x]    ] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x]    ].hn);
-    }
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x] + 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x] + 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] - 1][c->pos[dim_x] + 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x] + 1].hn);
-    }
-    if ((p[c->pos[dim_y]    ][c->pos[dim_x] - 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y]    ][c->pos[dim_x] - 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y]    ][c->pos[dim_x] - 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y]    ][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y]    ][c->pos[dim_x] + 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y]    ][c->pos[dim_x] + 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y]    ][c->pos[dim_x] + 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y]    ][c->pos[dim_x] + 1].hn);
-    }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x] - 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x] - 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x] - 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x]    ].hn) &&
-        (world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x]    ] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x]    ] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x]    ].hn);
+/* Every type's distance map code, indexed by character_type_t */
+static const struct {
+  void (*build)(map *m, pair_t source);
+  int (*can_repair)(map *m, pair_t from, pair_t to);
+  void (*repair)(map *m, pair_t to);
+} distance_maps[num_character_types] = {
+#define distance_map_entry(t) \
+  { distance_map<t>::build, distance_map<t>::can_repair, distance_map<t>::repair }
+  distance_map_entry(char_pc),
+  distance_map_entry(char_hiker),
+  distance_map_entry(char_rival),
+  distance_map_entry(char_swimmer),
+  distance_map_entry(char_other),
+#undef distance_map_entry
+};
+
+/* Work on one type's distance map: a repair, or a build from scratch */
+typedef struct pathfind_job {
+  character_type_t type;
+  int repair;
+} pathfind_job_t;
+
+/* Each job only writes world.dist[type] and pathfind_queues[type],    *
+ * so the jobs of a turn fan out over the worker pool, one type each,  *
+ * and are all finished before this returns and any NPC moves.         */
+static void pathfind_run(map *m, const pathfind_job_t *jobs, int n,
+                         int parallel)
+{
+  auto run = [m, jobs](size_t i) {
+    if (jobs[i].repair) {
+      distance_maps[jobs[i].type].repair(m, world.pc.pos);
+    } else {
+      distance_maps[jobs[i].type].build(m, world.pc.pos);
     }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x] + 1].hn) &&
-        (world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x] + 1] >
-         world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker))) {
-      world.hiker_dist[c->pos[dim_y] + 1][c->pos[dim_x] + 1] =
-        world.hiker_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_hiker);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x] + 1].hn);
+  };
+  int i;
+
+  if (parallel && n > 1) {
+    ThreadPool::shared().parallelFor(n, run);
+  } else {
+    for (i = 0; i < n; i++) {
+      run(i);
     }
   }
-  heap_delete(&h);
+}
+
+void pathfind_rebuild(map *m, rebuild_t how)
+{
+  static fibonacci_queue heap;
+  pathfind_job_t jobs[] = { { char_hiker, 0 }, { char_rival, 0 } };
 
-  heap_init(&h, rival_cmp, NULL);
+  if (how == rebuild_fibonacci) {
+    distance_map<char_hiker>::build(m, world.pc.pos, heap);
+    distance_map<char_rival>::build(m, world.pc.pos, heap);
+  } else {
+    pathfind_run(m, jobs, 2, how == rebuild_parallel);
+  }
+  world.dist_map = m;
+  world.dist_source[dim_x] = world.pc.pos[dim_x];
+  world.dist_source[dim_y] = world.pc.pos[dim_y];
+  world.dist_types = DIST_CHASERS;
+}
 
-  for (y = 1; y < MAP_Y - 1; y++) {
-    for (x = 1; x < MAP_X - 1; x++) {
-      if (ter_cost(x, y, char_rival) != DIJKSTRA_PATH_MAX) {
-        p[y][x].hn = heap_insert(&h, &p[y][x]);
-      } else {
-        p[y][x].hn = NULL;
-      }
-    }
+/* Bring the distance maps of `types` up to date with the PC's        *
+ * position.  Called every PC turn, so a PC that stayed put costs     *
+ * nothing and a single step only repairs what it changed.  Maps not  *
+ * asked for are left to go stale.                                   */
+void pathfind_types(map *m, uint32_t types)
+{
+  pathfind_job_t jobs[num_character_types];
+  int t, n, step;
+
+  step = (m == world.dist_map &&
+          (world.pc.pos[dim_x] != world.dist_source[dim_x] ||
+           world.pc.pos[dim_y] != world.dist_source[dim_y]));
+  if (m != world.dist_map) {
+    world.dist_types = 0;
+  } else if (step) {
+    world.dist_types &= types;
   }
 
-  while ((c = (path_t *) heap_remove_min(&h))) {
-    c->hn = NULL;
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x] - 1].hn) &&
-        (world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x] - 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x] - 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x]    ].hn) &&
-        (world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x]    ] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x]    ] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x]    ].hn);
-    }
-    if ((p[c->pos[dim_y] - 1][c->pos[dim_x] + 1].hn) &&
-        (world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x] + 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] - 1][c->pos[dim_x] + 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] - 1][c->pos[dim_x] + 1].hn);
+  for (n = t = 0; t < num_character_types; t++) {
+    if (!(types & (1u << t))) {
+      continue;
     }
-    if ((p[c->pos[dim_y]    ][c->pos[dim_x] - 1].hn) &&
-        (world.rival_dist[c->pos[dim_y]    ][c->pos[dim_x] - 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y]    ][c->pos[dim_x] - 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y]    ][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y]    ][c->pos[dim_x] + 1].hn) &&
-        (world.rival_dist[c->pos[dim_y]    ][c->pos[dim_x] + 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y]    ][c->pos[dim_x] + 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y]    ][c->pos[dim_x] + 1].hn);
-    }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x] - 1].hn) &&
-        (world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x] - 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x] - 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x] - 1].hn);
-    }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x]    ].hn) &&
-        (world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x]    ] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x]    ] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x]    ].hn);
-    }
-    if ((p[c->pos[dim_y] + 1][c->pos[dim_x] + 1].hn) &&
-        (world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x] + 1] >
-         world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-         ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival))) {
-      world.rival_dist[c->pos[dim_y] + 1][c->pos[dim_x] + 1] =
-        world.rival_dist[c->pos[dim_y]][c->pos[dim_x]] +
-        ter_cost(c->pos[dim_x], c->pos[dim_y], char_rival);
-      heap_decrease_key_no_replace(&h,
-                                   p[c->pos[dim_y] + 1][c->pos[dim_x] + 1].hn);
+    if (!(world.dist_types & (1u << t))) {
+      jobs[n].type = (character_type_t) t;
+      jobs[n++].repair = 0;
+    } else if (step) {
+      jobs[n].type = (character_type_t) t;
+      jobs[n++].repair = distance_maps[t].can_repair(m, world.dist_source,
+                                                     world.pc.pos);
     }
   }
-  heap_delete(&h);
+  pathfind_run(m, jobs, n, 1);
+
+  world.dist_map = m;
+  world.dist_source[dim_x] = world.pc.pos[dim_x];
+  world.dist_source[dim_y] = world.pc.pos[dim_y];
+  world.dist_types |= types;
+}
+
+void pathfind(map *m)
+{
+  pathfind_types(m, DIST_CHASERS);
 }
@@ -112,6 +112,11 @@ public:
     pokemons.push_back(pokemon);
   }
 
+  void addPokemon(PokeData &&pokemon)
+  {
+    pokemons.push_back(std::move(pokemon));
+  }
+
   void removePokemon(size_t index)
   {
     if (index < pokemons.size())
@@ -239,65 +244,22 @@ public:
 
   void healAllPokemon()
   {
-    auto findMaxHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
-    {
-      for (const auto &stat : stats)
-      {
-        if (stat.getStatIdentifier() == "maxHP")
-        {
-          return &stat;
-        }
-      }
-      return nullptr; // maxHP stat not found
-    };
-
     for (auto &pokemon : pokemons)
     {
-      const PokeStats *maxHPStat = findMaxHP(pokemon.getStatsList());
-      if (maxHPStat)
+      if (pokemon.hasStat(stat_hp) && pokemon.hasStat(stat_max_hp))
       {
-        // Find the HP stat and update its rating to match maxHP's rating
-        auto it = std::find_if(pokemon.getStatsList().begin(), pokemon.getStatsList().end(),
-                               [](const PokeStats &stat)
-                               { return stat.getStatIdentifier() == "hp"; });
-        if (it != pokemon.getStatsList().end())
-        {
-          it->setStatRating(maxHPStat->getStatRating());
-        }
+        pokemon.setHP(pokemon.getMaxHP());
       }
+      pokemon.restorePp();
     }
   }
 
   // Method to revive a fainted Pokemon (if you have revives)
     void revivePokemon(PokeData* faintedPokemon) {
     if (useRevive()) {
-        // Ensure the lambda functions return non-const pointers for modification
-        auto findHP = [](std::vector<PokeStats>& stats) -> PokeStats* {
-            for (auto& stat : stats) {
-                if (stat.getStatIdentifier() == "hp") {
-                    return &stat;
-                }
-            }
-            return nullptr; // HP stat not found
-        };
-
-        auto findMaxHP = [](const std::vector<PokeStats>& stats) -> const PokeStats* {
-            for (const auto& stat : stats) {
-                if (stat.getStatIdentifier() == "maxHP") {
-                    return &stat;
-                }
-            }
-            return nullptr; // maxHP stat not found
-        };
-
-        // Use non-const getStatsList() for modification
-        PokeStats* hpStat = findHP(faintedPokemon->getStatsList());
-        const PokeStats* maxHPStat = findMaxHP(faintedPokemon->getStatsList());
-
         // Revive the Pokemon to half of its max HP
-        if (hpStat && maxHPStat) {
-            int revivedHP = maxHPStat->getStatRating() / 2;
-            hpStat->setStatRating(revivedHP);
+        if (faintedPokemon->hasStat(stat_hp) && faintedPokemon->hasStat(stat_max_hp)) {
+            faintedPokemon->setHP(faintedPokemon->getMaxHP() / 2);
         }
     }
 }
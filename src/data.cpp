@@ -4,44 +4,116 @@
 #include <string>
 #include <iostream>
 #include "data.h"
+#include "snapshot.h"
 #include <memory>
 #include <iomanip> // Include for std::setw
 #include <climits>
+#include <charconv>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 /*CSVReader stuff*/
 
-std::vector<std::vector<std::string>> CSVReader::readCSV(const std::string& filename) {
-    std::vector<std::vector<std::string>> data;
-    
-    std::ifstream file(filename);
-    std::string line;
-
-    while (std::getline(file, line)) {
-        std::vector<std::string> row;
-        std::stringstream lineStream(line);
-        std::string cell;
-
-        // Special handling to correctly parse empty cells
-        while (lineStream.good()) {
-            std::getline(lineStream, cell, ',');
-            row.push_back(cell);
+CSVFile::CSVFile() : base(nullptr), length(0) {}
+
+CSVFile::~CSVFile() {
+    if (base) {
+        munmap(base, length);
+    }
+}
+
+bool CSVFile::open(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    if (st.st_size == 0) {
+        // Nothing to map; begin() == end()
+        close(fd);
+        return true;
+    }
+    void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+    base = mapped;
+    length = st.st_size;
+    return true;
+}
+
+const char* CSVReader::nextLine(const char* p, const char* end) {
+    while (p < end && *p != '\n') {
+        p++;
+    }
+    return p < end ? p + 1 : end;
+}
+
+std::vector<const char*> CSVReader::splitLines(const char* begin, const char* end, size_t parts) {
+    std::vector<const char*> bounds(1, begin);
+    size_t length = end - begin;
+    for (size_t i = 1; i < parts; i++) {
+        const char* cut = begin + length * i / parts;
+        if (cut <= bounds.back()) {
+            continue;
+        }
+        // Push the cut forward to the next line start
+        const char* lineStart = nextLine(cut - 1, end);
+        if (lineStart > bounds.back() && lineStart < end) {
+            bounds.push_back(lineStart);
         }
+    }
+    bounds.push_back(end);
+    return bounds;
+}
 
-        data.push_back(row);
+int CSVReader::parseInt(std::string_view field) {
+    int value;
+    const char* first = field.data();
+    const char* last = first + field.size();
+    if (first != last && *first == '+') {
+        first++; // from_chars does not accept a leading '+'
+    }
+    std::from_chars_result result = std::from_chars(first, last, value);
+    if (result.ec == std::errc::result_out_of_range) {
+        throw std::out_of_range("parseInt: " + std::string(field));
     }
+    if (field.empty() || result.ec != std::errc() || result.ptr != last) {
+        throw std::invalid_argument("parseInt: \"" + std::string(field) + "\"");
+    }
+    return value;
+}
 
-    return data;
+int CSVReader::parseInt(std::string_view field, int emptyValue) {
+    return field.empty() ? emptyValue : parseInt(field);
 }
 
 
 /*Data Object*/
-DataObjectList::DataObjectList(const std::string& filename) {
-    
-    data = CSVReader::readCSV(filename);
+void DataObjectList::readFile(const std::string& filename) {
+    bool firstRowIsHeader = true;
+    CSVReader::forEachRow(filename, [&](const CSVRow& row) {
+        if (firstRowIsHeader) {
+            firstRowIsHeader = false;
+            return;
+        }
+        addRow(row);
+    });
 }
 
-const std::vector<std::unique_ptr<DataObject>>& DataObjectList::getObjects() const {
-    return objects;
+void DataObjectList::readRange(const char* begin, const char* end) {
+    CSVReader::forEachRow(begin, end, [&](const CSVRow& row) {
+        addRow(row);
+    });
 }
 
 DataObjectList::~DataObjectList() {
@@ -57,14 +129,14 @@ DataObjectList::~DataObjectList() {
 
 // Pokemon class 
 // Implement the Pokemon constructor
-Pokemon::Pokemon(int id, std::string identifier, int speciesId, int height, int weight, int baseExp, int order, int isDefault)
+Pokemon::Pokemon(int id, Symbol identifier, int speciesId, int height, int weight, int baseExp, int order, int isDefault)
     : id(id), identifier(identifier), speciesId(speciesId), height(height), weight(weight), baseExp(baseExp), order(order), isDefault(isDefault) {
     
 }
 //override the print method 
 void Pokemon::printObject() const {
     std::cout << "ID: " << id << "\n"
-              << "Identifier: " << identifier << "\n"
+              << "Identifier: " << symbolText(identifier) << "\n"
               << "Species ID: " << speciesId << "\n"
               << "Height: " << height << "\n"
               << "Weight: " << weight << "\n"
@@ -74,51 +146,62 @@ void Pokemon::printObject() const {
 }
 
 //set the fields in the constructor 
-PokemonList::PokemonList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+PokemonList::PokemonList(const std::string& filename) {
+    readFile(filename);
 }
-//pokemon list setField override
-void PokemonList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    
-    bool firstRowIsHeader = true; // Set to true if the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            // Skip the first row if it contains headers
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 8) {
-            throw std::invalid_argument("Row does not contain the correct number of fields for a Pokemon object.");
-        }
-        try {
-            // Convert each string to the appropriate type and create a new Pokemon object
-            int id = std::stoi(row[0]);
-            std::string identifier = row[1];
-            int speciesId = std::stoi(row[2]);
-            int height = std::stoi(row[3]);
-            int weight = std::stoi(row[4]);
-            int baseExp = std::stoi(row[5]);
-            int order = std::stoi(row[6]);
-            int isDefault = std::stoi(row[7]);
-
-            // Add the new Pokemon object to the objects vector
-            objects.push_back(std::make_unique<Pokemon>(id, identifier, speciesId, height, weight, baseExp, order, isDefault));
-        } catch (const std::invalid_argument& e) {
-            // Handle the case where the string cannot be converted to an integer
-            std::cerr << "Invalid argument: " << e.what() << " for input string: " << row[0] << ", " << row[2] << ", " << row[3] << ", " << row[4] << ", " << row[5] << ", " << row[6] << ", " << row[7] << std::endl;
-            // Handle the error, e.g., by skipping this row, logging the error, or re-throwing the exception
-        } catch (const std::out_of_range& e) {
-            // Handle the case where the integer is out of range for int
-            std::cerr << "Out of range: " << e.what() << std::endl;
-            // Handle the error, e.g., by skipping this row, logging the error, or re-throwing the exception
-        }
+//pokemon list addRow override
+void PokemonList::addRow(const CSVRow& row) {
+    if (row.size() != 8) {
+        throw std::invalid_argument("Row does not contain the correct number of fields for a Pokemon object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new Pokemon object
+        int id = CSVReader::parseInt(row[0]);
+        Symbol identifier = intern(row[1]);
+        int speciesId = CSVReader::parseInt(row[2]);
+        int height = CSVReader::parseInt(row[3]);
+        int weight = CSVReader::parseInt(row[4]);
+        int baseExp = CSVReader::parseInt(row[5]);
+        int order = CSVReader::parseInt(row[6]);
+        int isDefault = CSVReader::parseInt(row[7]);
+
+        // Add the new Pokemon object to the table
+        rows.emplace_back(id, identifier, speciesId, height, weight, baseExp, order, isDefault);
+    } catch (const std::invalid_argument& e) {
+        // Handle the case where the string cannot be converted to an integer
+        std::cerr << "Invalid argument: " << e.what() << " for input string: " << row[0] << ", " << row[2] << ", " << row[3] << ", " << row[4] << ", " << row[5] << ", " << row[6] << ", " << row[7] << std::endl;
+        // Handle the error, e.g., by skipping this row, logging the error, or re-throwing the exception
+    } catch (const std::out_of_range& e) {
+        // Handle the case where the integer is out of range for int
+        std::cerr << "Out of range: " << e.what() << std::endl;
+        // Handle the error, e.g., by skipping this row, logging the error, or re-throwing the exception
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+PokemonList::PokemonList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void PokemonList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], intern(snapshot.string(r[1])), r[2], r[3], r[4], r[5], r[6], r[7]);
+    }
+}
+
+void PokemonList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const Pokemon& pokemon : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            pokemon.getId(), writer.addString(symbolText(pokemon.getIdentifierSymbol())), pokemon.getSpeciesId(), pokemon.getHeight(),
+            pokemon.getWeight(), pokemon.getBaseExp(), pokemon.getOrder(), pokemon.getIsDefault()
+        };
+        writer.addRow(r);
     }
 }
 
 void PokemonList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -133,18 +216,15 @@ void PokemonList::printData() const {
     }
 
     // Update column widths based on the data
-    for (const auto& obj : objects) {
-        const Pokemon* pokemon = dynamic_cast<const Pokemon*>(obj.get());
-        if (pokemon) {
-            columnWidths[0] = std::max(columnWidths[0], std::to_string(pokemon->getId()).length());
-            columnWidths[1] = std::max(columnWidths[1], pokemon->getIdentifier().length());
-            columnWidths[2] = std::max(columnWidths[2], std::to_string(pokemon->getSpeciesId()).length());
-            columnWidths[3] = std::max(columnWidths[3], std::to_string(pokemon->getHeight()).length());
-            columnWidths[4] = std::max(columnWidths[4], std::to_string(pokemon->getWeight()).length());
-            columnWidths[5] = std::max(columnWidths[5], std::to_string(pokemon->getBaseExp()).length());
-            columnWidths[6] = std::max(columnWidths[6], std::to_string(pokemon->getOrder()).length());
-            columnWidths[7] = std::max(columnWidths[7], std::to_string(pokemon->getIsDefault()).length());
-        }
+    for (const Pokemon& pokemon : rows) {
+        columnWidths[0] = std::max(columnWidths[0], std::to_string(pokemon.getId()).length());
+        columnWidths[1] = std::max(columnWidths[1], pokemon.getIdentifier().length());
+        columnWidths[2] = std::max(columnWidths[2], std::to_string(pokemon.getSpeciesId()).length());
+        columnWidths[3] = std::max(columnWidths[3], std::to_string(pokemon.getHeight()).length());
+        columnWidths[4] = std::max(columnWidths[4], std::to_string(pokemon.getWeight()).length());
+        columnWidths[5] = std::max(columnWidths[5], std::to_string(pokemon.getBaseExp()).length());
+        columnWidths[6] = std::max(columnWidths[6], std::to_string(pokemon.getOrder()).length());
+        columnWidths[7] = std::max(columnWidths[7], std::to_string(pokemon.getIsDefault()).length());
     }
 
     // Print the headers with proper spacing
@@ -154,34 +234,25 @@ void PokemonList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const Pokemon* pokemon = dynamic_cast<const Pokemon*>(obj.get());
-        if (pokemon) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << pokemon->getId()
-                      << std::left << std::setw(columnWidths[1] + 2) << pokemon->getIdentifier()
-                      << std::left << std::setw(columnWidths[2] + 2) << pokemon->getSpeciesId()
-                      << std::left << std::setw(columnWidths[3] + 2) << pokemon->getHeight()
-                      << std::left << std::setw(columnWidths[4] + 2) << pokemon->getWeight()
-                      << std::left << std::setw(columnWidths[5] + 2) << pokemon->getBaseExp()
-                      << std::left << std::setw(columnWidths[6] + 2) << pokemon->getOrder()
-                      << std::left << std::setw(columnWidths[7] + 2) << pokemon->getIsDefault()
-                      << std::endl;
-        }
+    for (const Pokemon& pokemon : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << pokemon.getId()
+                  << std::left << std::setw(columnWidths[1] + 2) << pokemon.getIdentifier()
+                  << std::left << std::setw(columnWidths[2] + 2) << pokemon.getSpeciesId()
+                  << std::left << std::setw(columnWidths[3] + 2) << pokemon.getHeight()
+                  << std::left << std::setw(columnWidths[4] + 2) << pokemon.getWeight()
+                  << std::left << std::setw(columnWidths[5] + 2) << pokemon.getBaseExp()
+                  << std::left << std::setw(columnWidths[6] + 2) << pokemon.getOrder()
+                  << std::left << std::setw(columnWidths[7] + 2) << pokemon.getIsDefault()
+                  << std::endl;
     }
 }
-// PokemonList class method to get a Pokemon by its ID using binary search
-Pokemon* PokemonList::getPokemonById(int id) {
-    for (const auto& obj : objects) {
-        // Cast the DataObject pointer to a Pokemon pointer
-        Pokemon* pokemon = dynamic_cast<Pokemon*>(obj.get());
-        if (pokemon && pokemon->getId() == id) {
-            // Found the Pokemon with the matching ID
-            return pokemon;
-        }
-    }
+// PokemonList class method to get a Pokemon by its ID through the id index
+const Pokemon* PokemonList::getPokemonById(int id) const {
+    return findById(id);
+}
 
-    // If the Pokemon with the given ID is not found, return nullptr
-    return nullptr;
+void PokemonList::indexRows() {
+    ids.build(rows, &Pokemon::getId);
 }
 
 
@@ -190,13 +261,13 @@ Pokemon* PokemonList::getPokemonById(int id) {
 
 // Moves class
 // Moves class constructor implementation
-Moves::Moves(int id, std::string identifier, int generationId, int typeId, int power, int pp, int accuracy, int priority, int targetId, int damageClass, int effectId, int effectChance, int contestTypeId, int contestEffectId, int superContestEffectId)
+Moves::Moves(int id, Symbol identifier, int generationId, int typeId, int power, int pp, int accuracy, int priority, int targetId, int damageClass, int effectId, int effectChance, int contestTypeId, int contestEffectId, int superContestEffectId)
     : id(id), identifier(identifier), generationId(generationId), typeId(typeId), power(power), pp(pp), accuracy(accuracy), priority(priority), targetId(targetId), damageClass(damageClass), effectId(effectId), effectChance(effectChance), contestTypeId(contestTypeId), contestEffectId(contestEffectId), superContestEffectId(superContestEffectId) {}
 
 // Override the print method for Moves
 void Moves::printObject() const {
     std::cout << "ID: " << id << "\n"
-              << "Identifier: " << identifier << "\n"
+              << "Identifier: " << symbolText(identifier) << "\n"
               << "Generation ID: " << generationId << "\n"
               << "Type ID: " << typeId << "\n"
               << "Power: " << power << "\n"
@@ -214,52 +285,71 @@ void Moves::printObject() const {
 
 
 //set the fields in the constructor 
-MovesList::MovesList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
-}
-// MovesList setFields override
-void MovesList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 15) { // Ensure the row has the correct number of fields for a Moves object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a Moves object.");
-        }
-        try {
-            // Convert each string to the appropriate type and create a new Moves object
-            int id = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            std::string identifier = row[1];
-            int generationId = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-            int typeId = row[3].empty() ? INT_MAX : std::stoi(row[3]);
-            int power = row[4].empty() ? 1 : std::stoi(row[4]); // Set to 1 for non-attack moves
-            int pp = row[5].empty() ? INT_MAX : std::stoi(row[5]);
-            int accuracy = row[6].empty() ? -1 : std::stoi(row[6]); // Set to -1 for moves where accuracy is not applicable
-            int priority = row[7].empty() ? INT_MAX : std::stoi(row[7]);
-            int targetId = row[8].empty() ? INT_MAX : std::stoi(row[8]);
-            int damageClass = row[9].empty() ? INT_MAX : std::stoi(row[9]);
-            int effectId = row[10].empty() ? INT_MAX : std::stoi(row[10]);
-            int effectChance = row[11].empty() ? INT_MAX : std::stoi(row[11]);
-            int contestTypeId = row[12].empty() ? INT_MAX : std::stoi(row[12]);
-            int contestEffectId = row[13].empty() ? INT_MAX : std::stoi(row[13]);
-            int superContestEffectId = row[14].empty() ? INT_MAX : std::stoi(row[14]);
-
-            // Add the new Moves object to the objects vector
-            objects.push_back(std::make_unique<Moves>(id, identifier, generationId, typeId, power, pp, accuracy, priority, targetId, damageClass, effectId, effectChance, contestTypeId, contestEffectId, superContestEffectId));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in Moves data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in Moves data." << std::endl;
-        }
+MovesList::MovesList(const std::string& filename) {
+    readFile(filename);
+}
+// MovesList addRow override
+void MovesList::addRow(const CSVRow& row) {
+    if (row.size() != 15) { // Ensure the row has the correct number of fields for a Moves object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a Moves object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new Moves object
+        int id = CSVReader::parseInt(row[0], INT_MAX);
+        Symbol identifier = intern(row[1]);
+        int generationId = CSVReader::parseInt(row[2], INT_MAX);
+        int typeId = CSVReader::parseInt(row[3], INT_MAX);
+        int power = CSVReader::parseInt(row[4], 1); // Set to 1 for non-attack moves
+        int pp = CSVReader::parseInt(row[5], INT_MAX);
+        int accuracy = CSVReader::parseInt(row[6], -1); // Set to -1 for moves where accuracy is not applicable
+        int priority = CSVReader::parseInt(row[7], INT_MAX);
+        int targetId = CSVReader::parseInt(row[8], INT_MAX);
+        int damageClass = CSVReader::parseInt(row[9], INT_MAX);
+        int effectId = CSVReader::parseInt(row[10], INT_MAX);
+        int effectChance = CSVReader::parseInt(row[11], INT_MAX);
+        int contestTypeId = CSVReader::parseInt(row[12], INT_MAX);
+        int contestEffectId = CSVReader::parseInt(row[13], INT_MAX);
+        int superContestEffectId = CSVReader::parseInt(row[14], INT_MAX);
+
+        // Add the new Moves object to the table
+        rows.emplace_back(id, identifier, generationId, typeId, power, pp, accuracy, priority, targetId, damageClass, effectId, effectChance, contestTypeId, contestEffectId, superContestEffectId);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in Moves data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in Moves data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+MovesList::MovesList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void MovesList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], intern(snapshot.string(r[1])), r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11], r[12], r[13], r[14]);
     }
 }
 
+void MovesList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const Moves& move : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            move.getId(), writer.addString(symbolText(move.getIdentifierSymbol())), move.getGenerationId(), move.getTypeId(),
+            move.getPower(), move.getPp(), move.getAccuracy(), move.getPriority(), move.getTargetId(),
+            move.getDamageClass(), move.getEffectId(), move.getEffectChance(), move.getContestTypeId(),
+            move.getContestEffectId(), move.getSuperContestEffectId()
+        };
+        writer.addRow(r);
+    }
+}
+
+void MovesList::indexRows() {
+    ids.build(rows, &Moves::getId);
+}
+
 void MovesList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -281,29 +371,26 @@ void MovesList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const Moves* move = dynamic_cast<const Moves*>(obj.get());
-        if (move) {
-            std::vector<std::string> fields = {
-                intToString(move->getId()),
-                move->getIdentifier(),
-                intToString(move->getGenerationId()),
-                intToString(move->getTypeId()),
-                intToString(move->getPower()),
-                intToString(move->getPp()),
-                intToString(move->getAccuracy()),
-                intToString(move->getPriority()),
-                intToString(move->getTargetId()),
-                intToString(move->getDamageClass()),
-                intToString(move->getEffectId()),
-                intToString(move->getEffectChance()),
-                intToString(move->getContestTypeId()),
-                intToString(move->getContestEffectId()),
-                intToString(move->getSuperContestEffectId())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const Moves& move : rows) {
+        std::vector<std::string> fields = {
+            intToString(move.getId()),
+            move.getIdentifier(),
+            intToString(move.getGenerationId()),
+            intToString(move.getTypeId()),
+            intToString(move.getPower()),
+            intToString(move.getPp()),
+            intToString(move.getAccuracy()),
+            intToString(move.getPriority()),
+            intToString(move.getTargetId()),
+            intToString(move.getDamageClass()),
+            intToString(move.getEffectId()),
+            intToString(move.getEffectChance()),
+            intToString(move.getContestTypeId()),
+            intToString(move.getContestEffectId()),
+            intToString(move.getSuperContestEffectId())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -314,26 +401,23 @@ void MovesList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const Moves* move = dynamic_cast<const Moves*>(obj.get());
-        if (move) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(move->getId())
-                      << std::left << std::setw(columnWidths[1] + 2) << move->getIdentifier()
-                      << std::left << std::setw(columnWidths[2] + 2) << intToString(move->getGenerationId())
-                      << std::left << std::setw(columnWidths[3] + 2) << intToString(move->getTypeId())
-                      << std::left << std::setw(columnWidths[4] + 2) << intToString(move->getPower())
-                      << std::left << std::setw(columnWidths[5] + 2) << intToString(move->getPp())
-                      << std::left << std::setw(columnWidths[6] + 2) << intToString(move->getAccuracy())
-                      << std::left << std::setw(columnWidths[7] + 2) << intToString(move->getPriority())
-                      << std::left << std::setw(columnWidths[8] + 2) << intToString(move->getTargetId())
-                      << std::left << std::setw(columnWidths[9] + 2) << intToString(move->getDamageClass())
-                      << std::left << std::setw(columnWidths[10] + 2) << intToString(move->getEffectId())
-                      << std::left << std::setw(columnWidths[11] + 2) << intToString(move->getEffectChance())
-                      << std::left << std::setw(columnWidths[12] + 2) << intToString(move->getContestTypeId())
-                      << std::left << std::setw(columnWidths[13] + 2) << intToString(move->getContestEffectId())
-                      << std::left << std::setw(columnWidths[14] + 2) << intToString(move->getSuperContestEffectId())
-                      << std::endl;
-        }
+    for (const Moves& move : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(move.getId())
+                  << std::left << std::setw(columnWidths[1] + 2) << move.getIdentifier()
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(move.getGenerationId())
+                  << std::left << std::setw(columnWidths[3] + 2) << intToString(move.getTypeId())
+                  << std::left << std::setw(columnWidths[4] + 2) << intToString(move.getPower())
+                  << std::left << std::setw(columnWidths[5] + 2) << intToString(move.getPp())
+                  << std::left << std::setw(columnWidths[6] + 2) << intToString(move.getAccuracy())
+                  << std::left << std::setw(columnWidths[7] + 2) << intToString(move.getPriority())
+                  << std::left << std::setw(columnWidths[8] + 2) << intToString(move.getTargetId())
+                  << std::left << std::setw(columnWidths[9] + 2) << intToString(move.getDamageClass())
+                  << std::left << std::setw(columnWidths[10] + 2) << intToString(move.getEffectId())
+                  << std::left << std::setw(columnWidths[11] + 2) << intToString(move.getEffectChance())
+                  << std::left << std::setw(columnWidths[12] + 2) << intToString(move.getContestTypeId())
+                  << std::left << std::setw(columnWidths[13] + 2) << intToString(move.getContestEffectId())
+                  << std::left << std::setw(columnWidths[14] + 2) << intToString(move.getSuperContestEffectId())
+                  << std::endl;
     }
 }
 
@@ -357,46 +441,112 @@ void PokemonMoves::printObject() const {
 }
 
 //set the fields in the constructor 
-PokemonMovesList::PokemonMovesList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
-}
-// PokemonMovesList setFields override
-void PokemonMovesList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
+PokemonMovesList::PokemonMovesList(const std::string& filename) {
+    readFile(filename);
+}
+
+PokemonMovesList::PokemonMovesList(const char* begin, const char* end) {
+    readRange(begin, end);
+}
+// PokemonMovesList addRow override
+void PokemonMovesList::addRow(const CSVRow& row) {
+    if (row.size() != 6) { // Ensure the row has the correct number of fields for a PokemonMoves object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonMoves object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new PokemonMoves object
+        int pokemonId = CSVReader::parseInt(row[0], INT_MAX);
+        int versionGroupId = CSVReader::parseInt(row[1], INT_MAX);
+        int moveId = CSVReader::parseInt(row[2], INT_MAX);
+        int pokemonMoveMethodId = CSVReader::parseInt(row[3], INT_MAX);
+        int level = CSVReader::parseInt(row[4], INT_MAX);
+        int order = CSVReader::parseInt(row[5], INT_MAX);
+
+        // Check if versionGroupId is equal to 1 before adding the object
+        if (versionGroupId == 1) {
+            // Add the new PokemonMoves object to the table only if versionGroupId is 1
+            rows.emplace_back(pokemonId, versionGroupId, moveId, pokemonMoveMethodId, level, order);
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonMoves data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in PokemonMoves data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+PokemonMovesList::PokemonMovesList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void PokemonMovesList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], r[2], r[3], r[4], r[5]);
+    }
+}
+
+void PokemonMovesList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const PokemonMoves& pokemonMove : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            pokemonMove.getPokemonId(), pokemonMove.getVersionGroupId(), pokemonMove.getMoveId(),
+            pokemonMove.getPokemonMoveMethodId(), pokemonMove.getLevel(), pokemonMove.getOrder()
+        };
+        writer.addRow(r);
+    }
+}
+
+// Group the rows by Pokemon id (counting sort), then order each group by
+// level.  Ties keep their file order.
+void PokemonMovesList::indexRows() {
+    int maxId = -1;
+    for (const PokemonMoves& row : rows) {
+        if (row.getPokemonId() != INT_MAX) {
+            maxId = std::max(maxId, row.getPokemonId());
         }
-        if (row.size() != 6) { // Ensure the row has the correct number of fields for a PokemonMoves object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonMoves object.");
+    }
+
+    learnsetOffsets.assign(maxId + 2, 0);
+    for (const PokemonMoves& row : rows) {
+        if (row.getPokemonId() >= 0 && row.getPokemonId() <= maxId) {
+            learnsetOffsets[row.getPokemonId() + 1]++;
         }
-        try {
-            // Convert each string to the appropriate type and create a new PokemonMoves object
-            int pokemonId = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            int versionGroupId = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            int moveId = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-            int pokemonMoveMethodId = row[3].empty() ? INT_MAX : std::stoi(row[3]);
-            int level = row[4].empty() ? INT_MAX : std::stoi(row[4]);
-            int order = row[5].empty() ? INT_MAX : std::stoi(row[5]);
-
-            // Check if versionGroupId is equal to 1 before adding the object
-            if (versionGroupId == 1) {
-                // Add the new PokemonMoves object to the objects vector only if versionGroupId is 1
-                objects.push_back(std::make_unique<PokemonMoves>(pokemonId, versionGroupId, moveId, pokemonMoveMethodId, level, order));
-            }
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonMoves data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in PokemonMoves data." << std::endl;
+    }
+    for (size_t i = 1; i < learnsetOffsets.size(); i++) {
+        learnsetOffsets[i] += learnsetOffsets[i - 1];
+    }
+
+    learnsetEntries.resize(learnsetOffsets.back());
+    std::vector<uint32_t> fill(learnsetOffsets.begin(), learnsetOffsets.end() - 1);
+    for (const PokemonMoves& row : rows) {
+        if (row.getPokemonId() >= 0 && row.getPokemonId() <= maxId) {
+            learnsetEntries[fill[row.getPokemonId()]++] = { row.getMoveId(), row.getLevel(), row.getPokemonMoveMethodId() };
         }
     }
+
+    for (size_t id = 0; id + 1 < learnsetOffsets.size(); id++) {
+        std::stable_sort(learnsetEntries.begin() + learnsetOffsets[id], learnsetEntries.begin() + learnsetOffsets[id + 1],
+                         [](const LearnsetEntry& a, const LearnsetEntry& b) { return a.level < b.level; });
+    }
+}
+
+LearnsetSpan PokemonMovesList::learnset(int pokemonId) const {
+    if (pokemonId < 0 || (size_t) pokemonId + 1 >= learnsetOffsets.size()) {
+        return LearnsetSpan(nullptr, nullptr);
+    }
+    const LearnsetEntry* base = learnsetEntries.data();
+    return LearnsetSpan(base + learnsetOffsets[pokemonId], base + learnsetOffsets[pokemonId + 1]);
+}
+
+LearnsetSpan PokemonMovesList::learnableAt(int pokemonId, int level) const {
+    LearnsetSpan all = learnset(pokemonId);
+    const LearnsetEntry* last = std::upper_bound(all.begin(), all.end(), level,
+                                                 [](int lvl, const LearnsetEntry& entry) { return lvl < entry.level; });
+    return LearnsetSpan(all.begin(), last);
 }
 
 void PokemonMovesList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -416,20 +566,17 @@ void PokemonMovesList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const PokemonMoves* pokemonMove = dynamic_cast<const PokemonMoves*>(obj.get());
-        if (pokemonMove) {
-            std::vector<std::string> fields = {
-                intToString(pokemonMove->getPokemonId()),
-                intToString(pokemonMove->getVersionGroupId()),
-                intToString(pokemonMove->getMoveId()),
-                intToString(pokemonMove->getPokemonMoveMethodId()),
-                intToString(pokemonMove->getLevel()),
-                intToString(pokemonMove->getOrder())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const PokemonMoves& pokemonMove : rows) {
+        std::vector<std::string> fields = {
+            intToString(pokemonMove.getPokemonId()),
+            intToString(pokemonMove.getVersionGroupId()),
+            intToString(pokemonMove.getMoveId()),
+            intToString(pokemonMove.getPokemonMoveMethodId()),
+            intToString(pokemonMove.getLevel()),
+            intToString(pokemonMove.getOrder())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -440,17 +587,14 @@ void PokemonMovesList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const PokemonMoves* pokemonMove = dynamic_cast<const PokemonMoves*>(obj.get());
-        if (pokemonMove) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonMove->getPokemonId())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonMove->getVersionGroupId())
-                      << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonMove->getMoveId())
-                      << std::left << std::setw(columnWidths[3] + 2) << intToString(pokemonMove->getPokemonMoveMethodId())
-                      << std::left << std::setw(columnWidths[4] + 2) << intToString(pokemonMove->getLevel())
-                      << std::left << std::setw(columnWidths[5] + 2) << intToString(pokemonMove->getOrder())
-                      << std::endl;
-        }
+    for (const PokemonMoves& pokemonMove : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonMove.getPokemonId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonMove.getVersionGroupId())
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonMove.getMoveId())
+                  << std::left << std::setw(columnWidths[3] + 2) << intToString(pokemonMove.getPokemonMoveMethodId())
+                  << std::left << std::setw(columnWidths[4] + 2) << intToString(pokemonMove.getLevel())
+                  << std::left << std::setw(columnWidths[5] + 2) << intToString(pokemonMove.getOrder())
+                  << std::endl;
     }
 }
 
@@ -464,13 +608,13 @@ void PokemonMovesList::printData() const {
 
 /*Pokemon species*/
 // PokemonSpecies class constructor implementation
-PokemonSpecies::PokemonSpecies(int id, std::string identifier, int generationId, int evolvesFromSpeciesId, int evolutionChainId, int colorId, int shapeId, int habitatId, int genderRate, int captureRate, int baseHappiness, int isBaby, int hatchCounter, int hasGenderDifferences, int growthRateId, int formsSwitchable, int isLegendary, int isMythical, int order, int conquestOrder)
+PokemonSpecies::PokemonSpecies(int id, Symbol identifier, int generationId, int evolvesFromSpeciesId, int evolutionChainId, int colorId, int shapeId, int habitatId, int genderRate, int captureRate, int baseHappiness, int isBaby, int hatchCounter, int hasGenderDifferences, int growthRateId, int formsSwitchable, int isLegendary, int isMythical, int order, int conquestOrder)
     : id(id), identifier(identifier), generationId(generationId), evolvesFromSpeciesId(evolvesFromSpeciesId), evolutionChainId(evolutionChainId), colorId(colorId), shapeId(shapeId), habitatId(habitatId), genderRate(genderRate), captureRate(captureRate), baseHappiness(baseHappiness), isBaby(isBaby), hatchCounter(hatchCounter), hasGenderDifferences(hasGenderDifferences), growthRateId(growthRateId), formsSwitchable(formsSwitchable), isLegendary(isLegendary), isMythical(isMythical), order(order), conquestOrder(conquestOrder) {}
 
 // Override the print method for PokemonSpecies
 void PokemonSpecies::printObject() const {
     std::cout << "ID: " << id << "\n"
-              << "Identifier: " << identifier << "\n"
+              << "Identifier: " << symbolText(identifier) << "\n"
               << "Generation ID: " << generationId << "\n"
               << "Evolves From Species ID: " << evolvesFromSpeciesId << "\n"
               << "Evolution Chain ID: " << evolutionChainId << "\n"
@@ -492,58 +636,79 @@ void PokemonSpecies::printObject() const {
 }
 
 //set the fields in the constructor 
-PokemonSpeciesList::PokemonSpeciesList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+PokemonSpeciesList::PokemonSpeciesList(const std::string& filename) {
+    readFile(filename);
 }
 
-// PokemonSpeciesList setFields override
-void PokemonSpeciesList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 20) { // Ensure the row has the correct number of fields for a PokemonSpecies object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonSpecies object.");
-        }
-        try {
-            // Convert each string to the appropriate type and create a new PokemonSpecies object
-            int id = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            std::string identifier = row[1]; // No need to check for empty, it's a string
-            int generationId = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-            int evolvesFromSpeciesId = row[3].empty() ? INT_MAX : std::stoi(row[3]);
-            int evolutionChainId = row[4].empty() ? INT_MAX : std::stoi(row[4]);
-            int colorId = row[5].empty() ? INT_MAX : std::stoi(row[5]);
-            int shapeId = row[6].empty() ? INT_MAX : std::stoi(row[6]);
-            int habitatId = row[7].empty() ? INT_MAX : std::stoi(row[7]);
-            int genderRate = row[8].empty() ? INT_MAX : std::stoi(row[8]);
-            int captureRate = row[9].empty() ? INT_MAX : std::stoi(row[9]);
-            int baseHappiness = row[10].empty() ? INT_MAX : std::stoi(row[10]);
-            int isBaby = row[11].empty() ? INT_MAX : std::stoi(row[11]);
-            int hatchCounter = row[12].empty() ? INT_MAX : std::stoi(row[12]);
-            int hasGenderDifferences = row[13].empty() ? INT_MAX : std::stoi(row[13]);
-            int growthRateId = row[14].empty() ? INT_MAX : std::stoi(row[14]);
-            int formsSwitchable = row[15].empty() ? INT_MAX : std::stoi(row[15]);
-            int isLegendary = row[16].empty() ? INT_MAX : std::stoi(row[16]);
-            int isMythical = row[17].empty() ? INT_MAX : std::stoi(row[17]);
-            int order = row[18].empty() ? INT_MAX : std::stoi(row[18]);
-            int conquestOrder = row[19].empty() ? INT_MAX : std::stoi(row[19]);
-
-            // Add the new PokemonSpecies object to the objects vector
-            objects.push_back(std::make_unique<PokemonSpecies>(id, identifier, generationId, evolvesFromSpeciesId, evolutionChainId, colorId, shapeId, habitatId, genderRate, captureRate, baseHappiness, isBaby, hatchCounter, hasGenderDifferences, growthRateId, formsSwitchable, isLegendary, isMythical, order, conquestOrder));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonSpecies data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in PokemonSpecies data." << std::endl;
-        }
+// PokemonSpeciesList addRow override
+void PokemonSpeciesList::addRow(const CSVRow& row) {
+    if (row.size() != 20) { // Ensure the row has the correct number of fields for a PokemonSpecies object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonSpecies object.");
     }
+    try {
+        // Convert each string to the appropriate type and create a new PokemonSpecies object
+        int id = CSVReader::parseInt(row[0], INT_MAX);
+        Symbol identifier = intern(row[1]);
+        int generationId = CSVReader::parseInt(row[2], INT_MAX);
+        int evolvesFromSpeciesId = CSVReader::parseInt(row[3], INT_MAX);
+        int evolutionChainId = CSVReader::parseInt(row[4], INT_MAX);
+        int colorId = CSVReader::parseInt(row[5], INT_MAX);
+        int shapeId = CSVReader::parseInt(row[6], INT_MAX);
+        int habitatId = CSVReader::parseInt(row[7], INT_MAX);
+        int genderRate = CSVReader::parseInt(row[8], INT_MAX);
+        int captureRate = CSVReader::parseInt(row[9], INT_MAX);
+        int baseHappiness = CSVReader::parseInt(row[10], INT_MAX);
+        int isBaby = CSVReader::parseInt(row[11], INT_MAX);
+        int hatchCounter = CSVReader::parseInt(row[12], INT_MAX);
+        int hasGenderDifferences = CSVReader::parseInt(row[13], INT_MAX);
+        int growthRateId = CSVReader::parseInt(row[14], INT_MAX);
+        int formsSwitchable = CSVReader::parseInt(row[15], INT_MAX);
+        int isLegendary = CSVReader::parseInt(row[16], INT_MAX);
+        int isMythical = CSVReader::parseInt(row[17], INT_MAX);
+        int order = CSVReader::parseInt(row[18], INT_MAX);
+        int conquestOrder = CSVReader::parseInt(row[19], INT_MAX);
+
+        // Add the new PokemonSpecies object to the table
+        rows.emplace_back(id, identifier, generationId, evolvesFromSpeciesId, evolutionChainId, colorId, shapeId, habitatId, genderRate, captureRate, baseHappiness, isBaby, hatchCounter, hasGenderDifferences, growthRateId, formsSwitchable, isLegendary, isMythical, order, conquestOrder);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonSpecies data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in PokemonSpecies data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+PokemonSpeciesList::PokemonSpeciesList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void PokemonSpeciesList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], intern(snapshot.string(r[1])), r[2], r[3], r[4], r[5], r[6], r[7], r[8], r[9], r[10], r[11], r[12], r[13], r[14], r[15], r[16], r[17], r[18], r[19]);
+    }
+}
+
+void PokemonSpeciesList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const PokemonSpecies& species : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            species.getId(), writer.addString(symbolText(species.getIdentifierSymbol())), species.getGenerationId(),
+            species.getEvolvesFromSpeciesId(), species.getEvolutionChainId(), species.getColorId(),
+            species.getShapeId(), species.getHabitatId(), species.getGenderRate(), species.getCaptureRate(),
+            species.getBaseHappiness(), species.getIsBaby(), species.getHatchCounter(),
+            species.getHasGenderDifferences(), species.getGrowthRateId(), species.getFormsSwitchable(),
+            species.getIsLegendary(), species.getIsMythical(), species.getOrder(), species.getConquestOrder()
+        };
+        writer.addRow(r);
+    }
+}
+
+void PokemonSpeciesList::indexRows() {
+    ids.build(rows, &PokemonSpecies::getId);
 }
 
 void PokemonSpeciesList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -566,34 +731,31 @@ void PokemonSpeciesList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const PokemonSpecies* species = dynamic_cast<const PokemonSpecies*>(obj.get());
-        if (species) {
-            std::vector<std::string> fields = {
-                intToString(species->getId()),
-                species->getIdentifier(),
-                intToString(species->getGenerationId()),
-                intToString(species->getEvolvesFromSpeciesId()),
-                intToString(species->getEvolutionChainId()),
-                intToString(species->getColorId()),
-                intToString(species->getShapeId()),
-                intToString(species->getHabitatId()),
-                intToString(species->getGenderRate()),
-                intToString(species->getCaptureRate()),
-                intToString(species->getBaseHappiness()),
-                intToString(species->getIsBaby()),
-                intToString(species->getHatchCounter()),
-                intToString(species->getHasGenderDifferences()),
-                intToString(species->getGrowthRateId()),
-                intToString(species->getFormsSwitchable()),
-                intToString(species->getIsLegendary()),
-                intToString(species->getIsMythical()),
-                intToString(species->getOrder()),
-                intToString(species->getConquestOrder())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const PokemonSpecies& species : rows) {
+        std::vector<std::string> fields = {
+            intToString(species.getId()),
+            species.getIdentifier(),
+            intToString(species.getGenerationId()),
+            intToString(species.getEvolvesFromSpeciesId()),
+            intToString(species.getEvolutionChainId()),
+            intToString(species.getColorId()),
+            intToString(species.getShapeId()),
+            intToString(species.getHabitatId()),
+            intToString(species.getGenderRate()),
+            intToString(species.getCaptureRate()),
+            intToString(species.getBaseHappiness()),
+            intToString(species.getIsBaby()),
+            intToString(species.getHatchCounter()),
+            intToString(species.getHasGenderDifferences()),
+            intToString(species.getGrowthRateId()),
+            intToString(species.getFormsSwitchable()),
+            intToString(species.getIsLegendary()),
+            intToString(species.getIsMythical()),
+            intToString(species.getOrder()),
+            intToString(species.getConquestOrder())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -603,30 +765,28 @@ void PokemonSpeciesList::printData() const {
     }
     std::cout << std::endl;
 
-    for (const auto& obj : objects) {
-    const PokemonSpecies* species = dynamic_cast<const PokemonSpecies*>(obj.get());
-    if (species) {
+    for (const PokemonSpecies& species : rows) {
         std::vector<std::string> fieldValues = {
-            intToString(species->getId()),
-            species->getIdentifier(),
-            intToString(species->getGenerationId()),
-            intToString(species->getEvolvesFromSpeciesId()),
-            intToString(species->getEvolutionChainId()),
-            intToString(species->getColorId()),
-            intToString(species->getShapeId()),
-            intToString(species->getHabitatId()),
-            intToString(species->getGenderRate()),
-            intToString(species->getCaptureRate()),
-            intToString(species->getBaseHappiness()),
-            intToString(species->getIsBaby()),
-            intToString(species->getHatchCounter()),
-            intToString(species->getHasGenderDifferences()),
-            intToString(species->getGrowthRateId()),
-            intToString(species->getFormsSwitchable()),
-            intToString(species->getIsLegendary()),
-            intToString(species->getIsMythical()),
-            intToString(species->getOrder()),
-            intToString(species->getConquestOrder())
+            intToString(species.getId()),
+            species.getIdentifier(),
+            intToString(species.getGenerationId()),
+            intToString(species.getEvolvesFromSpeciesId()),
+            intToString(species.getEvolutionChainId()),
+            intToString(species.getColorId()),
+            intToString(species.getShapeId()),
+            intToString(species.getHabitatId()),
+            intToString(species.getGenderRate()),
+            intToString(species.getCaptureRate()),
+            intToString(species.getBaseHappiness()),
+            intToString(species.getIsBaby()),
+            intToString(species.getHatchCounter()),
+            intToString(species.getHasGenderDifferences()),
+            intToString(species.getGrowthRateId()),
+            intToString(species.getFormsSwitchable()),
+            intToString(species.getIsLegendary()),
+            intToString(species.getIsMythical()),
+            intToString(species.getOrder()),
+            intToString(species.getConquestOrder())
         };
 
         for (std::size_t i = 0; i < headers.size(); ++i) {
@@ -635,7 +795,6 @@ void PokemonSpeciesList::printData() const {
         std::cout << std::endl;
     }
 }
-}
 
 
 
@@ -660,42 +819,74 @@ void Experience::printObject() const {
 }
 
 //set the fields in the constructor 
-ExperienceList::ExperienceList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+ExperienceList::ExperienceList(const std::string& filename) {
+    readFile(filename);
 }
 
-// ExperienceList setFields override
-void ExperienceList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 3) { // Ensure the row has the correct number of fields for an Experience object
-            throw std::invalid_argument("Row does not contain the correct number of fields for an Experience object.");
+// ExperienceList addRow override
+void ExperienceList::addRow(const CSVRow& row) {
+    if (row.size() != 3) { // Ensure the row has the correct number of fields for an Experience object
+        throw std::invalid_argument("Row does not contain the correct number of fields for an Experience object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new Experience object
+        int growthRate = CSVReader::parseInt(row[0], INT_MAX);
+        int level = CSVReader::parseInt(row[1], INT_MAX);
+        int exp = CSVReader::parseInt(row[2], INT_MAX);
+
+        // Add the new Experience object to the table
+        rows.emplace_back(growthRate, level, exp);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in Experience data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in Experience data." << std::endl;
+    }
+}
+
+
+// Build the list straight from snapshot records, skipping the CSV
+ExperienceList::ExperienceList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void ExperienceList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], r[2]);
+    }
+}
+
+void ExperienceList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const Experience& experience : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = { experience.getGrowthRate(), experience.getLevel(), experience.getExp() };
+        writer.addRow(r);
+    }
+}
+
+// Spread the (growth rate, level) rows into one dense row per growth rate
+void ExperienceList::indexRows() {
+    int maxRate = 0;
+    for (const Experience& row : rows) {
+        if (row.getGrowthRate() != INT_MAX) {
+            maxRate = std::max(maxRate, row.getGrowthRate());
         }
-        try {
-            // Convert each string to the appropriate type and create a new Experience object
-            int growthRate = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            int level = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            int exp = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-
-            // Add the new Experience object to the objects vector
-            objects.push_back(std::make_unique<Experience>(growthRate, level, exp));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in Experience data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in Experience data." << std::endl;
+    }
+    thresholds.assign((size_t) (maxRate + 1) * EXP_TABLE_STRIDE, INT_MAX);
+    for (int rate = 1; rate <= maxRate; rate++) {
+        thresholds[(size_t) rate * EXP_TABLE_STRIDE] = 0;
+    }
+    for (const Experience& row : rows) {
+        int rate = row.getGrowthRate();
+        int level = row.getLevel();
+        if (rate < 1 || rate > maxRate || level < 1 || level > MAX_LEVEL || row.getExp() == INT_MAX) {
+            continue;
         }
+        thresholds[(size_t) rate * EXP_TABLE_STRIDE + level] = row.getExp();
     }
 }
 
-
 void ExperienceList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -715,17 +906,14 @@ void ExperienceList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const Experience* experience = dynamic_cast<const Experience*>(obj.get());
-        if (experience) {
-            std::vector<std::string> fields = {
-                intToString(experience->getGrowthRate()),
-                intToString(experience->getLevel()),
-                intToString(experience->getExp())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const Experience& experience : rows) {
+        std::vector<std::string> fields = {
+            intToString(experience.getGrowthRate()),
+            intToString(experience.getLevel()),
+            intToString(experience.getExp())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -736,14 +924,11 @@ void ExperienceList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const Experience* experience = dynamic_cast<const Experience*>(obj.get());
-        if (experience) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(experience->getGrowthRate())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(experience->getLevel())
-                      << std::left << std::setw(columnWidths[2] + 2) << intToString(experience->getExp())
-                      << std::endl;
-        }
+    for (const Experience& experience : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(experience.getGrowthRate())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(experience.getLevel())
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(experience.getExp())
+                  << std::endl;
     }
 }
 
@@ -767,43 +952,57 @@ void TypeNames::printObject() const {
 }
 
 //set the fields in the constructor 
-TypeNamesList::TypeNamesList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+TypeNamesList::TypeNamesList(const std::string& filename) {
+    readFile(filename);
 }
 
-// Override the pure virtual function setFields
-void TypeNamesList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 3) { // Ensure the row has the correct number of fields for a TypeNames object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a TypeNames object.");
-        }
-        try {
-            // Check if localLanguageId is 9 before creating the object
-            int localLanguageId = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            if (localLanguageId == 9) {
-                int typeId = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-                std::string name = row[2]; // No need to check for empty, it's a string
-
-                // Add the new TypeNames object to the objects vector
-                objects.push_back(std::make_unique<TypeNames>(typeId, localLanguageId, name));
-            }
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in TypeNames data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in TypeNames data." << std::endl;
+// Override the pure virtual function addRow
+void TypeNamesList::addRow(const CSVRow& row) {
+    if (row.size() != 3) { // Ensure the row has the correct number of fields for a TypeNames object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a TypeNames object.");
+    }
+    try {
+        // Check if localLanguageId is 9 before creating the object
+        int localLanguageId = CSVReader::parseInt(row[1], INT_MAX);
+        if (localLanguageId == 9) {
+            int typeId = CSVReader::parseInt(row[0], INT_MAX);
+            std::string name(row[2]); // No need to check for empty, it's a string
+
+            // Add the new TypeNames object to the table
+            rows.emplace_back(typeId, localLanguageId, name);
         }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in TypeNames data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in TypeNames data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+TypeNamesList::TypeNamesList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void TypeNamesList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], std::string(snapshot.string(r[2])));
     }
 }
 
+void TypeNamesList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const TypeNames& typeName : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = { typeName.getTypeId(), typeName.getLocalLanguageId(), writer.addString(typeName.getName()) };
+        writer.addRow(r);
+    }
+}
+
+void TypeNamesList::indexRows() {
+    ids.build(rows, &TypeNames::getTypeId);
+}
+
 void TypeNamesList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -823,17 +1022,14 @@ void TypeNamesList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const TypeNames* typeName = dynamic_cast<const TypeNames*>(obj.get());
-        if (typeName) {
-            std::vector<std::string> fields = {
-                intToString(typeName->getTypeId()),
-                intToString(typeName->getLocalLanguageId()),
-                typeName->getName()
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const TypeNames& typeName : rows) {
+        std::vector<std::string> fields = {
+            intToString(typeName.getTypeId()),
+            intToString(typeName.getLocalLanguageId()),
+            typeName.getName()
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -844,14 +1040,11 @@ void TypeNamesList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const TypeNames* typeName = dynamic_cast<const TypeNames*>(obj.get());
-        if (typeName) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(typeName->getTypeId())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(typeName->getLocalLanguageId())
-                      << std::left << std::setw(columnWidths[2] + 2) << typeName->getName()
-                      << std::endl;
-        }
+    for (const TypeNames& typeName : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(typeName.getTypeId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(typeName.getLocalLanguageId())
+                  << std::left << std::setw(columnWidths[2] + 2) << typeName.getName()
+                  << std::endl;
     }
 }
 
@@ -869,42 +1062,76 @@ void PokemonStats::printObject() const {
 }
 
 //set the fields in the constructor 
-PokemonStatsList::PokemonStatsList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+PokemonStatsList::PokemonStatsList(const std::string& filename) {
+    readFile(filename);
 }
 
-// PokemonStatsList setFields override
-void PokemonStatsList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 4) { // Ensure the row has the correct number of fields for a PokemonStats object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonStats object.");
+// PokemonStatsList addRow override
+void PokemonStatsList::addRow(const CSVRow& row) {
+    if (row.size() != 4) { // Ensure the row has the correct number of fields for a PokemonStats object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonStats object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new PokemonStats object
+        int pokemonId = CSVReader::parseInt(row[0], INT_MAX);
+        int statId = CSVReader::parseInt(row[1], INT_MAX);
+        int baseStat = CSVReader::parseInt(row[2], INT_MAX);
+        int effort = CSVReader::parseInt(row[3], INT_MAX);
+
+        // Add the new PokemonStats object to the table
+        rows.emplace_back(pokemonId, statId, baseStat, effort);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonStats data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in PokemonStats data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+PokemonStatsList::PokemonStatsList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void PokemonStatsList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], r[2], r[3]);
+    }
+}
+
+void PokemonStatsList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const PokemonStats& pokemonStat : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            pokemonStat.getPokemonId(), pokemonStat.getStatId(), pokemonStat.getBaseStat(), pokemonStat.getEffort()
+        };
+        writer.addRow(r);
+    }
+}
+
+// Fold the (pokemon, stat) rows into one fixed-size block per Pokemon
+void PokemonStatsList::indexRows() {
+    int maxId = -1;
+    for (const PokemonStats& row : rows) {
+        if (row.getPokemonId() != INT_MAX) {
+            maxId = std::max(maxId, row.getPokemonId());
         }
-        try {
-            // Convert each string to the appropriate type and create a new PokemonStats object
-            int pokemonId = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            int statId = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            int baseStat = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-            int effort = row[3].empty() ? INT_MAX : std::stoi(row[3]);
-
-            // Add the new PokemonStats object to the objects vector
-            objects.push_back(std::make_unique<PokemonStats>(pokemonId, statId, baseStat, effort));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonStats data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in PokemonStats data." << std::endl;
+    }
+    baseStatBlocks.assign(maxId + 1, BaseStats());
+    hasBaseStats.assign(maxId + 1, false);
+    for (const PokemonStats& row : rows) {
+        int id = row.getPokemonId();
+        int stat = row.getStatId() - 1;
+        if (id < 0 || id > maxId || stat < 0 || stat >= NUM_BASE_STATS) {
+            continue;
         }
+        baseStatBlocks[id].base[stat] = row.getBaseStat();
+        baseStatBlocks[id].effort[stat] = row.getEffort() == INT_MAX ? 0 : row.getEffort();
+        hasBaseStats[id] = true;
     }
 }
 
 void PokemonStatsList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -924,18 +1151,15 @@ void PokemonStatsList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const PokemonStats* pokemonStat = dynamic_cast<const PokemonStats*>(obj.get());
-        if (pokemonStat) {
-            std::vector<std::string> fields = {
-                intToString(pokemonStat->getPokemonId()),
-                intToString(pokemonStat->getStatId()),
-                intToString(pokemonStat->getBaseStat()),
-                intToString(pokemonStat->getEffort())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const PokemonStats& pokemonStat : rows) {
+        std::vector<std::string> fields = {
+            intToString(pokemonStat.getPokemonId()),
+            intToString(pokemonStat.getStatId()),
+            intToString(pokemonStat.getBaseStat()),
+            intToString(pokemonStat.getEffort())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -946,71 +1170,84 @@ void PokemonStatsList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const PokemonStats* pokemonStat = dynamic_cast<const PokemonStats*>(obj.get());
-        if (pokemonStat) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonStat->getPokemonId())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonStat->getStatId())
-                      << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonStat->getBaseStat())
-                      << std::left << std::setw(columnWidths[3] + 2) << intToString(pokemonStat->getEffort())
-                      << std::endl;
-        }
+    for (const PokemonStats& pokemonStat : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonStat.getPokemonId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonStat.getStatId())
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonStat.getBaseStat())
+                  << std::left << std::setw(columnWidths[3] + 2) << intToString(pokemonStat.getEffort())
+                  << std::endl;
     }
 }
 
 
 /*Stats stuff*/
 // Stats class constructor implementation
-Stats::Stats(int id, int damageClassId, std::string identifier, int isBattleOnly, int gameIndex)
+Stats::Stats(int id, int damageClassId, Symbol identifier, int isBattleOnly, int gameIndex)
     : id(id), damageClassId(damageClassId), identifier(identifier), isBattleOnly(isBattleOnly), gameIndex(gameIndex) {}
 
 // Override the print method for Stats
 void Stats::printObject() const {
     std::cout << "ID: " << id << "\n"
               << "Damage Class ID: " << damageClassId << "\n"
-              << "Identifier: " << identifier << "\n"
+              << "Identifier: " << symbolText(identifier) << "\n"
               << "Is Battle Only: " << isBattleOnly << "\n"
               << "Game Index: " << gameIndex << std::endl;
 }
 
 //set the fields in the constructor 
-StatsList::StatsList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+StatsList::StatsList(const std::string& filename) {
+    readFile(filename);
 }
 
-// StatsList setFields override
-void StatsList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 5) { // Ensure the row has the correct number of fields for a Stats object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a Stats object.");
-        }
-        try {
-            // Convert each string to the appropriate type and create a new Stats object
-            int id = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            int damageClassId = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            std::string identifier = row[2]; // No need to check for empty, it's a string
-            int isBattleOnly = row[3].empty() ? INT_MAX : std::stoi(row[3]);
-            int gameIndex = row[4].empty() ? INT_MAX : std::stoi(row[4]);
-
-            // Add the new Stats object to the objects vector
-            objects.push_back(std::make_unique<Stats>(id, damageClassId, identifier, isBattleOnly, gameIndex));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in Stats data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in Stats data." << std::endl;
-        }
+// StatsList addRow override
+void StatsList::addRow(const CSVRow& row) {
+    if (row.size() != 5) { // Ensure the row has the correct number of fields for a Stats object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a Stats object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new Stats object
+        int id = CSVReader::parseInt(row[0], INT_MAX);
+        int damageClassId = CSVReader::parseInt(row[1], INT_MAX);
+        Symbol identifier = intern(row[2]);
+        int isBattleOnly = CSVReader::parseInt(row[3], INT_MAX);
+        int gameIndex = CSVReader::parseInt(row[4], INT_MAX);
+
+        // Add the new Stats object to the table
+        rows.emplace_back(id, damageClassId, identifier, isBattleOnly, gameIndex);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in Stats data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in Stats data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+StatsList::StatsList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void StatsList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], intern(snapshot.string(r[2])), r[3], r[4]);
+    }
+}
+
+void StatsList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const Stats& stat : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = {
+            stat.getId(), stat.getDamageClassId(), writer.addString(symbolText(stat.getIdentifierSymbol())), stat.getIsBattleOnly(), stat.getGameIndex()
+        };
+        writer.addRow(r);
     }
 }
 
+void StatsList::indexRows() {
+    ids.build(rows, &Stats::getId);
+}
+
 void StatsList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -1030,19 +1267,16 @@ void StatsList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const Stats* stat = dynamic_cast<const Stats*>(obj.get());
-        if (stat) {
-            std::vector<std::string> fields = {
-                intToString(stat->getId()),
-                intToString(stat->getDamageClassId()),
-                stat->getIdentifier(),
-                intToString(stat->getIsBattleOnly()),
-                intToString(stat->getGameIndex())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const Stats& stat : rows) {
+        std::vector<std::string> fields = {
+            intToString(stat.getId()),
+            intToString(stat.getDamageClassId()),
+            stat.getIdentifier(),
+            intToString(stat.getIsBattleOnly()),
+            intToString(stat.getGameIndex())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -1053,16 +1287,13 @@ void StatsList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const Stats* stat = dynamic_cast<const Stats*>(obj.get());
-        if (stat) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(stat->getId())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(stat->getDamageClassId())
-                      << std::left << std::setw(columnWidths[2] + 2) << stat->getIdentifier()
-                      << std::left << std::setw(columnWidths[3] + 2) << intToString(stat->getIsBattleOnly())
-                      << std::left << std::setw(columnWidths[4] + 2) << intToString(stat->getGameIndex())
-                      << std::endl;
-        }
+    for (const Stats& stat : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(stat.getId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(stat.getDamageClassId())
+                  << std::left << std::setw(columnWidths[2] + 2) << stat.getIdentifier()
+                  << std::left << std::setw(columnWidths[3] + 2) << intToString(stat.getIsBattleOnly())
+                  << std::left << std::setw(columnWidths[4] + 2) << intToString(stat.getGameIndex())
+                  << std::endl;
     }
 }
 
@@ -1083,41 +1314,69 @@ void PokemonTypes::printObject() const {
 }
 
 //set the fields in the constructor 
-PokemonTypesList::PokemonTypesList(const std::string& filename) : DataObjectList(filename) {
-    // Now that the base class constructor has read the CSV data into `data`,
-    // call setFields to initialize the objects based on that data.
-    setFields(data);
+PokemonTypesList::PokemonTypesList(const std::string& filename) {
+    readFile(filename);
 }
 
-// PokemonTypesList setFields override
-void PokemonTypesList::setFields(const std::vector<std::vector<std::string>>& newData) {
-    bool firstRowIsHeader = true; // Assuming the first row is always a header
-    for (const auto& row : newData) {
-        if (firstRowIsHeader) {
-            firstRowIsHeader = false;
-            continue;
-        }
-        if (row.size() != 3) { // Ensure the row has the correct number of fields for a PokemonTypes object
-            throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonTypes object.");
+// PokemonTypesList addRow override
+void PokemonTypesList::addRow(const CSVRow& row) {
+    if (row.size() != 3) { // Ensure the row has the correct number of fields for a PokemonTypes object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a PokemonTypes object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new PokemonTypes object
+        int pokemonId = CSVReader::parseInt(row[0], INT_MAX);
+        int typeId = CSVReader::parseInt(row[1], INT_MAX);
+        int slot = CSVReader::parseInt(row[2], INT_MAX);
+
+        // Add the new PokemonTypes object to the table
+        rows.emplace_back(pokemonId, typeId, slot);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonTypes data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in PokemonTypes data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+PokemonTypesList::PokemonTypesList(const TableSnapshot& snapshot) {
+    loadRecords(snapshot);
+}
+
+void PokemonTypesList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], r[2]);
+    }
+}
+
+void PokemonTypesList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const PokemonTypes& pokemonType : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = { pokemonType.getPokemonId(), pokemonType.getTypeId(), pokemonType.getSlot() };
+        writer.addRow(r);
+    }
+}
+
+void PokemonTypesList::indexRows() {
+    int maxId = -1;
+    for (const PokemonTypes& row : rows) {
+        if (row.getPokemonId() != INT_MAX) {
+            maxId = std::max(maxId, row.getPokemonId());
         }
-        try {
-            // Convert each string to the appropriate type and create a new PokemonTypes object
-            int pokemonId = row[0].empty() ? INT_MAX : std::stoi(row[0]);
-            int typeId = row[1].empty() ? INT_MAX : std::stoi(row[1]);
-            int slot = row[2].empty() ? INT_MAX : std::stoi(row[2]);
-
-            // Add the new PokemonTypes object to the objects vector
-            objects.push_back(std::make_unique<PokemonTypes>(pokemonId, typeId, slot));
-        } catch (const std::invalid_argument& e) {
-            std::cerr << "Invalid argument: " << e.what() << " for input string in PokemonTypes data." << std::endl;
-        } catch (const std::out_of_range& e) {
-            std::cerr << "Out of range: " << e.what() << " in PokemonTypes data." << std::endl;
+    }
+    typePairs.assign(maxId + 1, TypePair{ { 0, 0 } });
+    for (const PokemonTypes& row : rows) {
+        int id = row.getPokemonId();
+        int slot = row.getSlot() - 1;
+        if (id < 0 || id > maxId || slot < 0 || slot > 1 || row.getTypeId() < 1 || row.getTypeId() > NUM_TYPES) {
+            continue;
         }
+        typePairs[id].type[slot] = row.getTypeId();
     }
 }
 
 void PokemonTypesList::printData() const {
-    if (objects.empty()) {
+    if (rows.empty()) {
         std::cerr << "No data to print." << std::endl;
         return;
     }
@@ -1137,17 +1396,14 @@ void PokemonTypesList::printData() const {
     for (std::size_t i = 0; i < headers.size(); ++i) {
         columnWidths[i] = headers[i].length();
     }
-    for (const auto& obj : objects) {
-        const PokemonTypes* pokemonType = dynamic_cast<const PokemonTypes*>(obj.get());
-        if (pokemonType) {
-            std::vector<std::string> fields = {
-                intToString(pokemonType->getPokemonId()),
-                intToString(pokemonType->getTypeId()),
-                intToString(pokemonType->getSlot())
-            };
-            for (std::size_t i = 0; i < fields.size(); ++i) {
-                columnWidths[i] = std::max(columnWidths[i], fields[i].length());
-            }
+    for (const PokemonTypes& pokemonType : rows) {
+        std::vector<std::string> fields = {
+            intToString(pokemonType.getPokemonId()),
+            intToString(pokemonType.getTypeId()),
+            intToString(pokemonType.getSlot())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
         }
     }
 
@@ -1158,14 +1414,133 @@ void PokemonTypesList::printData() const {
     std::cout << std::endl;
 
     // Print the data with aligned columns
-    for (const auto& obj : objects) {
-        const PokemonTypes* pokemonType = dynamic_cast<const PokemonTypes*>(obj.get());
-        if (pokemonType) {
-            std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonType->getPokemonId())
-                      << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonType->getTypeId())
-                      << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonType->getSlot())
-                      << std::endl;
+    for (const PokemonTypes& pokemonType : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(pokemonType.getPokemonId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(pokemonType.getTypeId())
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(pokemonType.getSlot())
+                  << std::endl;
+    }
+}
+
+
+
+
+
+/*TypeEfficacy stuff*/
+// TypeEfficacy class constructor implementation
+TypeEfficacy::TypeEfficacy(int damageTypeId, int targetTypeId, int damageFactor)
+    : damageTypeId(damageTypeId), targetTypeId(targetTypeId), damageFactor(damageFactor) {}
+
+// Override the print method for TypeEfficacy
+void TypeEfficacy::printObject() const {
+    std::cout << "Damage Type ID: " << damageTypeId << "\n"
+              << "Target Type ID: " << targetTypeId << "\n"
+              << "Damage Factor: " << damageFactor << std::endl;
+}
+
+//set the fields in the constructor 
+TypeEfficacyList::TypeEfficacyList(const std::string& filename) {
+    std::fill(&matrix[0][0], &matrix[0][0] + sizeof(matrix), 100);
+    readFile(filename);
+}
+
+// TypeEfficacyList addRow override
+void TypeEfficacyList::addRow(const CSVRow& row) {
+    if (row.size() != 3) { // Ensure the row has the correct number of fields for a TypeEfficacy object
+        throw std::invalid_argument("Row does not contain the correct number of fields for a TypeEfficacy object.");
+    }
+    try {
+        // Convert each string to the appropriate type and create a new TypeEfficacy object
+        int damageTypeId = CSVReader::parseInt(row[0], INT_MAX);
+        int targetTypeId = CSVReader::parseInt(row[1], INT_MAX);
+        int damageFactor = CSVReader::parseInt(row[2], INT_MAX);
+
+        // Add the new TypeEfficacy object to the table
+        rows.emplace_back(damageTypeId, targetTypeId, damageFactor);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid argument: " << e.what() << " for input string in TypeEfficacy data." << std::endl;
+    } catch (const std::out_of_range& e) {
+        std::cerr << "Out of range: " << e.what() << " in TypeEfficacy data." << std::endl;
+    }
+}
+
+// Build the list straight from snapshot records, skipping the CSV
+TypeEfficacyList::TypeEfficacyList(const TableSnapshot& snapshot) {
+    std::fill(&matrix[0][0], &matrix[0][0] + sizeof(matrix), 100);
+    loadRecords(snapshot);
+}
+
+void TypeEfficacyList::loadRecords(const TableSnapshot& snapshot) {
+    for (uint64_t i = 0; i < snapshot.size(); i++) {
+        const int32_t* r = snapshot.row(i);
+        rows.emplace_back(r[0], r[1], r[2]);
+    }
+}
+
+void TypeEfficacyList::saveRecords(TableSnapshotWriter& writer) const {
+    for (const TypeEfficacy& efficacy : rows) {
+        int32_t r[SNAPSHOT_COLUMNS] = { efficacy.getDamageTypeId(), efficacy.getTargetTypeId(), efficacy.getDamageFactor() };
+        writer.addRow(r);
+    }
+}
+
+void TypeEfficacyList::indexRows() {
+    std::fill(&matrix[0][0], &matrix[0][0] + sizeof(matrix), 100);
+    for (const TypeEfficacy& efficacy : rows) {
+        int attack = efficacy.getDamageTypeId();
+        int target = efficacy.getTargetTypeId();
+        int factor = efficacy.getDamageFactor();
+        if (attack < 1 || attack > NUM_TYPES || target < 1 || target > NUM_TYPES || factor < 0 || factor > UINT8_MAX) {
+            continue;
         }
+        matrix[attack][target] = factor;
+    }
+}
+
+void TypeEfficacyList::printData() const {
+    if (rows.empty()) {
+        std::cerr << "No data to print." << std::endl;
+        return;
+    }
+
+    // Custom headers for the TypeEfficacyList
+    std::vector<std::string> headers = {
+        "Damage Type ID", "Target Type ID", "Damage Factor"
+    };
+
+    // Lambda function to handle INT_MAX values
+    auto intToString = [](int value) -> std::string {
+        return value == INT_MAX ? "" : std::to_string(value);
+    };
+
+    // Determine the maximum width needed for each column
+    std::vector<std::size_t> columnWidths(headers.size(), 0);
+    for (std::size_t i = 0; i < headers.size(); ++i) {
+        columnWidths[i] = headers[i].length();
+    }
+    for (const TypeEfficacy& efficacy : rows) {
+        std::vector<std::string> fields = {
+            intToString(efficacy.getDamageTypeId()),
+            intToString(efficacy.getTargetTypeId()),
+            intToString(efficacy.getDamageFactor())
+        };
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            columnWidths[i] = std::max(columnWidths[i], fields[i].length());
+        }
+    }
+
+    // Print the headers with proper spacing
+    for (std::size_t i = 0; i < headers.size(); ++i) {
+        std::cout << std::left << std::setw(columnWidths[i] + 2) << headers[i]; // +2 for padding
+    }
+    std::cout << std::endl;
+
+    // Print the data with aligned columns
+    for (const TypeEfficacy& efficacy : rows) {
+        std::cout << std::left << std::setw(columnWidths[0] + 2) << intToString(efficacy.getDamageTypeId())
+                  << std::left << std::setw(columnWidths[1] + 2) << intToString(efficacy.getTargetTypeId())
+                  << std::left << std::setw(columnWidths[2] + 2) << intToString(efficacy.getDamageFactor())
+                  << std::endl;
     }
 }
 
@@ -8,35 +8,113 @@
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <cstdint>
+#include <string_view>
+#include <iterator>
+#include <unordered_map>
+#include <climits>
+#include <algorithm>
+#include "symbol.h"
+
+class TableSnapshot;
+class TableSnapshotWriter;
+
+// One parsed CSV line.  Fields point straight into the file buffer and are
+// only valid for the duration of the callback that receives them.
+typedef std::vector<std::string_view> CSVRow;
+
+// Read-only memory mapping of a whole CSV file
+class CSVFile {
+private:
+    void* base;
+    size_t length;
+
+public:
+    CSVFile();
+    ~CSVFile();
+    CSVFile(const CSVFile&) = delete;
+    CSVFile& operator=(const CSVFile&) = delete;
+
+    // Map the file at path; false if it cannot be opened
+    bool open(const std::string& path);
+
+    const char* begin() const { return (const char*) base; }
+    const char* end() const { return (const char*) base + length; }
+};
 
 // Generic CSV Reader
 class CSVReader {
 public:
-    static std::vector<std::vector<std::string>> readCSV(const std::string& filename);
+    // Call onRow for every non-empty line in [begin, end).  A single row
+    // vector is reused, so nothing is allocated per line once it has grown.
+    template <class F>
+    static void forEachRow(const char* begin, const char* end, F&& onRow);
+
+    // Map filename and stream each of its rows to onRow; false if unreadable
+    template <class F>
+    static bool forEachRow(const std::string& filename, F&& onRow);
+
+    // Start of the line after the one containing p (end if there is none)
+    static const char* nextLine(const char* p, const char* end);
+
+    // Cut [begin, end) into at most parts slices of about equal size, each
+    // starting at the beginning of a line.  Returns the slice boundaries,
+    // first == begin and last == end.
+    static std::vector<const char*> splitLines(const char* begin, const char* end, size_t parts);
+
+    // Parse a whole field as a base-10 int.  Throws std::invalid_argument if
+    // it is empty or not a number, std::out_of_range if it does not fit.
+    static int parseInt(std::string_view field);
+    // As above, but an empty field yields emptyValue
+    static int parseInt(std::string_view field, int emptyValue);
 };
 
+template <class F>
+void CSVReader::forEachRow(const char* begin, const char* end, F&& onRow) {
+    CSVRow row;
+    const char* p = begin;
+    while (p < end) {
+        const char* lineEnd = p;
+        while (lineEnd < end && *lineEnd != '\n') {
+            lineEnd++;
+        }
+        const char* next = lineEnd < end ? lineEnd + 1 : end;
+        if (lineEnd > p && lineEnd[-1] == '\r') {
+            lineEnd--;
+        }
+        if (lineEnd > p) {
+            row.clear();
+            const char* field = p;
+            for (const char* c = p; c < lineEnd; c++) {
+                if (*c == ',') {
+                    row.emplace_back(field, c - field);
+                    field = c + 1;
+                }
+            }
+            row.emplace_back(field, lineEnd - field);
+            onRow(row);
+        }
+        p = next;
+    }
+}
 
+template <class F>
+bool CSVReader::forEachRow(const std::string& filename, F&& onRow) {
+    CSVFile file;
+    if (!file.open(filename)) {
+        return false;
+    }
+    forEachRow(file.begin(), file.end(), onRow);
+    return true;
+}
 
-// Base class for all Data objects
-class DataObject {
-protected:
-    
-
-public:
-    // Virtual method for printing object data
-    virtual void printObject() const = 0;
 
-    // Virtual destructor to ensure proper cleanup
-    virtual ~DataObject() {}
-
-      
-};
 
 // Derived class for Pokemon CSV
-class Pokemon : public DataObject {
+class Pokemon {
 private:
     int id;
-    std::string identifier;
+    Symbol identifier;
     int speciesId;
     int height;
     int weight;
@@ -44,15 +122,16 @@ private:
     int order;
     int isDefault;
 public:
-    Pokemon(int id, std::string identifier,int speciesId,int height,int weight, int baseExp, int order, int isDefault);
-    Pokemon() {
+    Pokemon(int id, Symbol identifier,int speciesId,int height,int weight, int baseExp, int order, int isDefault);
+    Pokemon() : identifier(0) {
         // Initialize members to default values if necessary
     }
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
     // Getter methods for each field
     int getId() const { return id; }
-    std::string getIdentifier() const { return identifier; }
+    std::string getIdentifier() const { return symbolText(identifier); }
+    Symbol getIdentifierSymbol() const { return identifier; }
     int getSpeciesId() const { return speciesId; }
     int getHeight() const { return height; }
     int getWeight() const { return weight; }
@@ -62,10 +141,10 @@ public:
 };
 
 
-class Moves : public DataObject {
+class Moves {
 private:
     int id;
-    std::string identifier;
+    Symbol identifier;
     int generationId;
     int typeId;
     int power;
@@ -80,14 +159,15 @@ private:
     int contestEffectId;
     int superContestEffectId;
 public:
-    Moves(int id, std::string identifier, int generationId, int typeId, int power, int pp, int accuracy, int priority, int targetId, int damageClass, int effectId, int effectChance, int contestTypeId, int contestEffectId, int superContestEffectId);
-    Moves(){};
+    Moves(int id, Symbol identifier, int generationId, int typeId, int power, int pp, int accuracy, int priority, int targetId, int damageClass, int effectId, int effectChance, int contestTypeId, int contestEffectId, int superContestEffectId);
+    Moves() : identifier(0) {};
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getId() const { return id; }
-    std::string getIdentifier() const { return identifier; }
+    std::string getIdentifier() const { return symbolText(identifier); }
+    Symbol getIdentifierSymbol() const { return identifier; }
     int getGenerationId() const { return generationId; }
     int getTypeId() const { return typeId; }
     int getPower() const { return power; }
@@ -103,7 +183,7 @@ public:
     int getSuperContestEffectId() const { return superContestEffectId; }
 };
 
-class PokemonMoves : public DataObject {
+class PokemonMoves {
 private:
     int pokemonId;
     int versionGroupId;
@@ -117,7 +197,7 @@ public:
     PokemonMoves(int pokemonId, int versionGroupId, int moveId, int pokemonMoveMethodId, int level, int order);
     PokemonMoves(){};
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getPokemonId() const { return pokemonId; }
@@ -129,10 +209,10 @@ public:
 };
 
 // Derived class for Pokemon CSV
-class PokemonSpecies : public DataObject {
+class PokemonSpecies {
 private:
     int id;
-    std::string identifier;
+    Symbol identifier;
     int generationId;
     int evolvesFromSpeciesId;
     int evolutionChainId;
@@ -154,14 +234,15 @@ private:
 
 public:
     // Public constructor with an initializer list
-    PokemonSpecies(int id, std::string identifier, int generationId, int evolvesFromSpeciesId, int evolutionChainId, int colorId, int shapeId, int habitatId, int genderRate, int captureRate, int baseHappiness, int isBaby, int hatchCounter, int hasGenderDifferences, int growthRateId, int formsSwitchable, int isLegendary, int isMythical, int order, int conquestOrder);
+    PokemonSpecies(int id, Symbol identifier, int generationId, int evolvesFromSpeciesId, int evolutionChainId, int colorId, int shapeId, int habitatId, int genderRate, int captureRate, int baseHappiness, int isBaby, int hatchCounter, int hasGenderDifferences, int growthRateId, int formsSwitchable, int isLegendary, int isMythical, int order, int conquestOrder);
     
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
      // Getter methods
     int getId() const { return id; }
-    std::string getIdentifier() const { return identifier; }
+    std::string getIdentifier() const { return symbolText(identifier); }
+    Symbol getIdentifierSymbol() const { return identifier; }
     int getGenerationId() const { return generationId; }
     int getEvolvesFromSpeciesId() const { return evolvesFromSpeciesId; }
     int getEvolutionChainId() const { return evolutionChainId; }
@@ -183,7 +264,7 @@ public:
 };
 
 // Derived class for Pokemon CSV
-class Experience : public DataObject {
+class Experience {
 private:
     int growthRate;
     int level;
@@ -193,7 +274,7 @@ public:
     Experience(int growthRate, int level, int exp);
 
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getGrowthRate() const { return growthRate; }
@@ -203,7 +284,7 @@ public:
 };
 
 // Derived class for Pokemon CSV
-class TypeNames : public DataObject {
+class TypeNames {
 private:
     int typeId;
     int localLanguageId;
@@ -214,7 +295,7 @@ public:
     TypeNames(int typeId, int localLanguageId, std::string name);
 
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getTypeId() const { return typeId; }
@@ -223,7 +304,7 @@ public:
 };
 
 // Derived class for Pokemon CSV
-class PokemonStats : public DataObject {
+class PokemonStats {
 private:
     int pokemonId;
     int statId;
@@ -235,7 +316,7 @@ public:
     PokemonStats(int pokemonId, int statId, int baseStat, int effort);
 
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getPokemonId() const { return pokemonId; }
@@ -245,31 +326,32 @@ public:
 };
 
 // Derived class for Pokemon CSV
-class Stats : public DataObject {
+class Stats {
 private:
     int id;
     int damageClassId;
-    std::string identifier;
+    Symbol identifier;
     int isBattleOnly;
     int gameIndex;
 
 public:
     // Public constructor with an initializer list
-    Stats(int id, int damageClassId, std::string identifier, int isBattleOnly, int gameIndex);
-    Stats(){};
+    Stats(int id, int damageClassId, Symbol identifier, int isBattleOnly, int gameIndex);
+    Stats() : identifier(0) {};
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getId() const { return id; }
     int getDamageClassId() const { return damageClassId; }
-    std::string getIdentifier() const { return identifier; }
+    std::string getIdentifier() const { return symbolText(identifier); }
+    Symbol getIdentifierSymbol() const { return identifier; }
     int getIsBattleOnly() const { return isBattleOnly; }
     int getGameIndex() const { return gameIndex; }
 };
 
 // Derived class for Pokemon CSV
-class PokemonTypes : public DataObject {
+class PokemonTypes {
 private:
     int pokemonId;
     int typeId;
@@ -280,7 +362,7 @@ public:
     PokemonTypes(int pokemonId, int typeId, int slot);
 
     // Override the printObject method
-    void printObject() const override;
+    void printObject() const;
 
     // Getter methods
     int getPokemonId() const { return pokemonId; }
@@ -288,129 +370,521 @@ public:
     int getSlot() const { return slot; }
 };
 
+// Derived class for Pokemon CSV
+class TypeEfficacy {
+private:
+    int damageTypeId;
+    int targetTypeId;
+    int damageFactor;
+
+public:
+    // Public constructor with an initializer list
+    TypeEfficacy(int damageTypeId, int targetTypeId, int damageFactor);
+
+    // Override the printObject method
+    void printObject() const;
+
+    // Getter methods
+    int getDamageTypeId() const { return damageTypeId; }
+    int getTargetTypeId() const { return targetTypeId; }
+    int getDamageFactor() const { return damageFactor; }
+};
+
+// Dense id -> row position lookup for tables keyed by a small, non-negative
+// id column.  Ids outside the table map to -1.
+class IdIndex {
+private:
+    std::vector<int32_t> slots;
+
+public:
+    template <class T>
+    void build(const std::vector<T>& rows, int (T::*key)() const);
+
+    int32_t find(int id) const { return id >= 0 && (size_t) id < slots.size() ? slots[id] : -1; }
+};
+
+template <class T>
+void IdIndex::build(const std::vector<T>& rows, int (T::*key)() const) {
+    int maxId = -1;
+    for (const T& row : rows) {
+        int id = (row.*key)();
+        if (id != INT_MAX && id > maxId) {
+            maxId = id;
+        }
+    }
+    slots.assign(maxId + 1, -1);
+    for (size_t i = 0; i < rows.size(); i++) {
+        int id = (rows[i].*key)();
+        // First row wins if an id repeats
+        if (id >= 0 && id != INT_MAX && slots[id] < 0) {
+            slots[id] = i;
+        }
+    }
+}
+
+// Secondary index over any int column of a table: for each key, the rows
+// holding it in table order.  Keys spanning a compact range are resolved
+// through a dense offset array, anything sparser through a hash map.
+template <class T>
+class ColumnIndex {
+private:
+    const std::vector<T>* rows = nullptr;
+    std::vector<uint32_t> positions; // row positions grouped by key
+    bool dense = true;
+    int minKey = 0;
+    std::vector<uint32_t> offsets; // dense: key - minKey -> start in positions
+    std::unordered_map<int, std::pair<uint32_t, uint32_t>> sparse; // key -> [start, end)
+
+public:
+    // Rows matching one key; iterates as const T&
+    class Range {
+    private:
+        const T* base;
+        const uint32_t* first;
+        const uint32_t* last;
+
+    public:
+        class iterator {
+        private:
+            const T* base;
+            const uint32_t* at;
+
+        public:
+            iterator(const T* base, const uint32_t* at) : base(base), at(at) {}
+            const T& operator*() const { return base[*at]; }
+            iterator& operator++() { ++at; return *this; }
+            bool operator!=(const iterator& other) const { return at != other.at; }
+        };
+
+        Range(const T* base, const uint32_t* first, const uint32_t* last) : base(base), first(first), last(last) {}
+        iterator begin() const { return iterator(base, first); }
+        iterator end() const { return iterator(base, last); }
+        size_t size() const { return last - first; }
+        bool empty() const { return first == last; }
+    };
+
+    void build(const std::vector<T>& table, int (T::*key)() const);
+    Range find(int key) const;
+};
+
+template <class T>
+void ColumnIndex<T>::build(const std::vector<T>& table, int (T::*key)() const) {
+    rows = &table;
+    positions.clear();
+    offsets.clear();
+    sparse.clear();
+    if (table.empty()) {
+        dense = true;
+        minKey = 0;
+        return;
+    }
+
+    int lo = INT_MAX, hi = INT_MIN;
+    for (const T& row : table) {
+        int k = (row.*key)();
+        lo = std::min(lo, k);
+        hi = std::max(hi, k);
+    }
+    // Dense when the offset array would be no bigger than a few times the row count
+    uint64_t span = (uint64_t) ((int64_t) hi - lo) + 1;
+    dense = span <= 4 * (uint64_t) table.size() + 1024;
+
+    if (dense) {
+        // Counting sort by key keeps rows with equal keys in table order
+        minKey = lo;
+        offsets.assign(span + 1, 0);
+        for (const T& row : table) {
+            offsets[(row.*key)() - lo + 1]++;
+        }
+        for (size_t k = 1; k < offsets.size(); k++) {
+            offsets[k] += offsets[k - 1];
+        }
+        positions.resize(table.size());
+        std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < table.size(); i++) {
+            positions[fill[(table[i].*key)() - lo]++] = i;
+        }
+    } else {
+        std::unordered_map<int, std::vector<uint32_t>> groups;
+        for (size_t i = 0; i < table.size(); i++) {
+            groups[(table[i].*key)()].push_back(i);
+        }
+        positions.reserve(table.size());
+        for (const auto& group : groups) {
+            uint32_t start = positions.size();
+            positions.insert(positions.end(), group.second.begin(), group.second.end());
+            sparse[group.first] = std::make_pair(start, (uint32_t) positions.size());
+        }
+    }
+}
+
+template <class T>
+typename ColumnIndex<T>::Range ColumnIndex<T>::find(int key) const {
+    const T* base = rows ? rows->data() : nullptr;
+    const uint32_t* p = positions.data();
+    if (dense) {
+        int64_t k = (int64_t) key - minKey;
+        if (k < 0 || k + 1 >= (int64_t) offsets.size()) {
+            return Range(base, p, p);
+        }
+        return Range(base, p + offsets[k], p + offsets[k + 1]);
+    }
+    auto it = sparse.find(key);
+    if (it == sparse.end()) {
+        return Range(base, p, p);
+    }
+    return Range(base, p + it->second.first, p + it->second.second);
+}
+
 // Base class for all DataList objects
 class DataObjectList {
 protected:
-    std::vector<std::vector<std::string>> data;
+    DataObjectList() {}
+
+    // Stream every data row of a CSV file (the header is skipped) to addRow
+    void readFile(const std::string& filename);
+    // Stream the rows of a slice of a mapped CSV (no header) to addRow
+    void readRange(const char* begin, const char* end);
 
 public:
-    // Constructor that reads data from a CSV file
-    DataObjectList(const std::string& filename);
-    std::vector<std::unique_ptr<DataObject>> objects;
     // Pure virtual method for printing data
     virtual void printData() const = 0;
 
-    // Pure virtual function for setting fields
-    virtual void setFields(const std::vector<std::vector<std::string>>& data) = 0;
+    // Pure virtual function building one object from a CSV data row
+    virtual void addRow(const CSVRow& row) = 0;
 
-    // Method to get access to the objects vector
-    const std::vector<std::unique_ptr<DataObject>>& getObjects() const;
+    // Pure virtual functions converting objects to/from snapshot records
+    virtual void loadRecords(const TableSnapshot& snapshot) = 0;
+    virtual void saveRecords(TableSnapshotWriter& writer) const = 0;
 
+    // Build the lookup indexes once every row is in place (no-op by default)
+    virtual void indexRows() {}
 
     // Virtual destructor to ensure proper cleanup
     virtual ~DataObjectList();
 };
 
+// Typed table: rows are stored by value in one contiguous vector, so
+// consumers walk them directly without virtual calls or casts.  Only the
+// load/print utilities above go through the DataObjectList interface.
+template <class T>
+class DataTable : public DataObjectList {
+protected:
+    std::vector<T> rows;
+    IdIndex ids; // filled by indexRows() of tables that have an id column
+
+public:
+    typedef T Row;
+
+    size_t size() const { return rows.size(); }
+    bool empty() const { return rows.empty(); }
+    const T& operator[](size_t index) const { return rows[index]; }
+    const T* begin() const { return rows.data(); }
+    const T* end() const { return rows.data() + rows.size(); }
+    const std::vector<T>& getRows() const { return rows; }
+
+    // O(1) row lookup by id; nullptr if absent or the table has no id index
+    const T* findById(int id) const {
+        int32_t position = ids.find(id);
+        return position < 0 ? nullptr : &rows[position];
+    }
+
+    // Move every row of other onto the end of this table
+    void append(DataTable<T>&& other) {
+        if (rows.empty()) {
+            rows = std::move(other.rows);
+        } else {
+            rows.insert(rows.end(), std::make_move_iterator(other.rows.begin()), std::make_move_iterator(other.rows.end()));
+        }
+        other.rows.clear();
+    }
+    void reserve(size_t count) { rows.reserve(count); }
+};
+
 // Derived class for Pokemon CSV
-class PokemonList : public DataObjectList {
+class PokemonList : public DataTable<Pokemon> {
 public:
     // Using DataObject's constructor
     //using DataObjectList::DataObjectList;
     // Explicitly declare the constructor that takes a filename
     PokemonList(const std::string& filename);
+    PokemonList(const TableSnapshot& snapshot);
     
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
-    Pokemon* getPokemonById(int id);
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 8;
+    const Pokemon* getPokemonById(int id) const;
 };
 
 // Derived class for Pokemon CSV
-class MovesList : public DataObjectList {
+class MovesList : public DataTable<Moves> {
 public:
     
     MovesList(const std::string& filename);
+    MovesList(const TableSnapshot& snapshot);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 15;
+};
+
+// One move a Pokemon can learn, as held by the learnset index
+struct LearnsetEntry {
+    int moveId;
+    int level;
+    int method; // pokemon_move_method_id
+};
+
+// A Pokemon's learnset entries: contiguous and sorted by level
+class LearnsetSpan {
+private:
+    const LearnsetEntry* first;
+    const LearnsetEntry* last;
+
+public:
+    LearnsetSpan(const LearnsetEntry* first, const LearnsetEntry* last) : first(first), last(last) {}
+    const LearnsetEntry* begin() const { return first; }
+    const LearnsetEntry* end() const { return last; }
+    size_t size() const { return last - first; }
+    bool empty() const { return first == last; }
+    const LearnsetEntry& operator[](size_t index) const { return first[index]; }
 };
 
 // Derived class for Pokemon CSV
-class PokemonMovesList : public DataObjectList {
+class PokemonMovesList : public DataTable<PokemonMoves> {
 public:
 
     PokemonMovesList(const std::string& filename);
+    PokemonMovesList(const TableSnapshot& snapshot);
+    // Rows of one slice of pokemon_moves.csv, for parsing the file in chunks
+    PokemonMovesList(const char* begin, const char* end);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 6;
+    // Every move one Pokemon can learn, ordered by level
+    LearnsetSpan learnset(int pokemonId) const;
+    // The moves a Pokemon can know at a given level (entry level <= level)
+    LearnsetSpan learnableAt(int pokemonId, int level) const;
+
+private:
+    // Learnset of Pokemon id i is learnsetEntries[learnsetOffsets[i], learnsetOffsets[i + 1])
+    std::vector<uint32_t> learnsetOffsets;
+    std::vector<LearnsetEntry> learnsetEntries;
 };
 
 // Derived class for Pokemon CSV
-class PokemonSpeciesList : public DataObjectList {
+class PokemonSpeciesList : public DataTable<PokemonSpecies> {
 public:
     
     PokemonSpeciesList(const std::string& filename);
+    PokemonSpeciesList(const TableSnapshot& snapshot);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 20;
 };
 
 // Derived class for Pokemon CSV
-class ExperienceList : public DataObjectList {
+// Highest level in experience.csv
+#define MAX_LEVEL 100
+// Entries per growth rate in the dense experience table: a power of two
+// above MAX_LEVEL, so levelForExp() searches it in a fixed number of steps
+#define EXP_TABLE_STRIDE 128
+
+class ExperienceList : public DataTable<Experience> {
 public:
    
    ExperienceList(const std::string& filename);
+   ExperienceList(const TableSnapshot& snapshot);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 3;
+
+    // Total experience needed to reach level; INT_MAX past MAX_LEVEL or for
+    // an unknown growth rate
+    int expForLevel(int growthRate, int level) const {
+        const int32_t* row = thresholdRow(growthRate);
+        return row && level >= 0 && level < EXP_TABLE_STRIDE ? row[level] : INT_MAX;
+    }
+
+    // Experience still needed to go from level to the next; 0 at MAX_LEVEL
+    int expToNextLevel(int growthRate, int level, int exp) const {
+        int next = expForLevel(growthRate, level + 1);
+        return next == INT_MAX ? 0 : std::max(next - exp, 0);
+    }
+
+    // Level reached with exp total experience (1 for an unknown growth rate)
+    int levelForExp(int growthRate, int exp) const {
+        const int32_t* row = thresholdRow(growthRate);
+        if (!row) {
+            return 1;
+        }
+        // Largest level whose threshold is <= exp; the halving steps add up
+        // to EXP_TABLE_STRIDE - 1 and each compiles to a conditional move.
+        // The INT_MAX padding passes for a saturated total, hence the cap.
+        int level = 0;
+        for (int step = EXP_TABLE_STRIDE / 2; step > 0; step /= 2) {
+            level += row[level + step] <= exp ? step : 0;
+        }
+        return std::min(std::max(level, 1), MAX_LEVEL);
+    }
+
+private:
+    // [growthRate][level], EXP_TABLE_STRIDE entries per rate; unused levels
+    // hold INT_MAX
+    std::vector<int32_t> thresholds;
+
+    const int32_t* thresholdRow(int growthRate) const {
+        size_t offset = (size_t) growthRate * EXP_TABLE_STRIDE;
+        return growthRate > 0 && offset < thresholds.size() ? &thresholds[offset] : nullptr;
+    }
 };
 
 // Derived class for Pokemon CSV
-class TypeNamesList : public DataObjectList {
+class TypeNamesList : public DataTable<TypeNames> {
 public:
     
    TypeNamesList(const std::string& filename);
+   TypeNamesList(const TableSnapshot& snapshot);
 
-   // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+   // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 3;
+};
+
+// Number of permanent stats in stats.csv (ids 1..6: hp, attack, defense,
+// special-attack, special-defense, speed)
+#define NUM_BASE_STATS 6
+
+// A Pokemon's base stats and effort yields, indexed by stat id - 1
+struct BaseStats {
+    int32_t base[NUM_BASE_STATS];
+    int32_t effort[NUM_BASE_STATS];
 };
 
 // Derived class for Pokemon CSV
-class PokemonStatsList : public DataObjectList {
+class PokemonStatsList : public DataTable<PokemonStats> {
 public:
     
    PokemonStatsList(const std::string& filename);
+   PokemonStatsList(const TableSnapshot& snapshot);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 4;
+    // Base stat block of one Pokemon; nullptr if it has no stat rows
+    const BaseStats* baseStats(int pokemonId) const {
+        return pokemonId >= 0 && (size_t) pokemonId < hasBaseStats.size() && hasBaseStats[pokemonId] ? &baseStatBlocks[pokemonId] : nullptr;
+    }
+
+private:
+    // Dense by Pokemon id
+    std::vector<BaseStats> baseStatBlocks;
+    std::vector<bool> hasBaseStats;
 };
 
 // Derived class for Pokemon CSV
-class StatsList : public DataObjectList {
+class StatsList : public DataTable<Stats> {
 public:
      
    StatsList(const std::string& filename);
+   StatsList(const TableSnapshot& snapshot);
 
-    // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+    // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 5;
+};
+
+// Number of elemental types (type ids 1..18 in type_names.csv; the
+// unknown/shadow ids above 10000 have no matchups)
+#define NUM_TYPES 18
+
+// A Pokemon's types by slot; 0 marks an empty second slot
+struct TypePair {
+    int8_t type[2];
 };
 
 // Derived class for Pokemon CSV
-class PokemonTypesList : public DataObjectList {
+class PokemonTypesList : public DataTable<PokemonTypes> {
 public:
       
    PokemonTypesList(const std::string& filename);
+   PokemonTypesList(const TableSnapshot& snapshot);
 
-   // Override the pure virtual function setFields
-    void setFields(const std::vector<std::vector<std::string>>& data) override;
+   // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
     void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 3;
+    // Types of one Pokemon; both slots 0 if it has no type rows
+    TypePair typesOf(int pokemonId) const {
+        return pokemonId >= 0 && (size_t) pokemonId < typePairs.size() ? typePairs[pokemonId] : TypePair{ { 0, 0 } };
+    }
+
+private:
+    // Dense by Pokemon id
+    std::vector<TypePair> typePairs;
+};
+
+// Derived class for Pokemon CSV
+class TypeEfficacyList : public DataTable<TypeEfficacy> {
+public:
+
+   TypeEfficacyList(const std::string& filename);
+   TypeEfficacyList(const TableSnapshot& snapshot);
+
+   // Override the pure virtual function addRow
+    void addRow(const CSVRow& row) override;
+    void printData() const override;
+    void loadRecords(const TableSnapshot& snapshot) override;
+    void saveRecords(TableSnapshotWriter& writer) const override;
+    void indexRows() override;
+    static const uint32_t SNAPSHOT_COLUMNS = 3;
+    // Damage percentage of an attack type against one defending type (0,
+    // 50, 100 or 200); 100 for type ids without a matchup
+    int factor(int damageType, int targetType) const {
+        return (unsigned) damageType <= NUM_TYPES && (unsigned) targetType <= NUM_TYPES ? matrix[damageType][targetType] : 100;
+    }
+
+private:
+    // Dense [damage type][target type], row and column 0 neutral
+    uint8_t matrix[NUM_TYPES + 1][NUM_TYPES + 1];
 };
 
 
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include "experience.h"
+
+int statForLevel(stat_t stat, int base, int iv, int level) {
+    int growth = (2 * base + iv) * level / 100;
+    return stat == stat_hp || stat == stat_max_hp ? growth + level + 10 : growth + 5;
+}
+
+void startExperience(PokeData& pokemon) {
+    const PokemonSpeciesList* speciesList = pokedex.pokemonSpecies();
+    const ExperienceList* experience = pokedex.experience();
+    const PokemonSpecies* species = speciesList ? speciesList->findById(pokemon.getPokemon().getSpeciesId()) : nullptr;
+    if (!species || !experience) {
+        return;
+    }
+    pokemon.setGrowthRate(species->getGrowthRateId());
+    int floor = experience->expForLevel(pokemon.getGrowthRate(), pokemon.getLevel());
+    pokemon.setExp(floor == INT_MAX ? 0 : floor);
+}
+
+int battleExperience(const PokeData& defeated) {
+    int baseExp = defeated.getPokemon().getBaseExp();
+    if (baseExp == INT_MAX) {
+        baseExp = 0;
+    }
+    // The classic yield, with the 1.5x bonus for a trainer's Pokemon
+    return std::max(baseExp * defeated.getLevel() * 3 / 14, 1);
+}
+
+
+int gainExperience(PokeData& pokemon, int exp) {
+    const ExperienceList* experience = pokedex.experience();
+    if (!experience || exp <= 0) {
+        return 0;
+    }
+    int total = (int) std::min<int64_t>((int64_t) pokemon.getExp() + exp, INT_MAX);
+    pokemon.setExp(total);
+
+    int oldLevel = pokemon.getLevel();
+    int newLevel = std::max(experience->levelForExp(pokemon.getGrowthRate(), total), oldLevel);
+    if (newLevel == oldLevel) {
+        return 0;
+    }
+    pokemon.setLevel(newLevel);
+
+    // Base stats line up with the first NUM_BASE_STATS stat slots
+    const BaseStats& base = pokemon.getBaseStats();
+    for (int s = 0; s < NUM_BASE_STATS; s++) {
+        stat_t stat = (stat_t) s;
+        if (!pokemon.hasStat(stat)) {
+            continue;
+        }
+        int gain = statForLevel(stat, base.base[s], pokemon.getIV(stat), newLevel) -
+                   statForLevel(stat, base.base[s], pokemon.getIV(stat), oldLevel);
+        if (stat == stat_hp) {
+            // Max HP grows and current HP keeps the same damage taken
+            pokemon.setStat(stat_max_hp, pokemon.getMaxHP() + gain);
+        }
+        pokemon.setStat(stat, pokemon.getStat(stat) + gain);
+    }
+    return newLevel - oldLevel;
+}
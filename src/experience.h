@@ -0,0 +1,29 @@
+// experience.h
+#ifndef EXPERIENCE_H
+#define EXPERIENCE_H
+
+#include "prints.h"
+
+// Experience and levelling.  Thresholds come from the dense growth-rate
+// table in ExperienceList, so every query below is constant time however
+// large the roster.
+
+// A stat at a level, from its base value and IV: (2 x base + IV) x level / 100,
+// plus level + 10 for HP (also used for max HP) or 5 for any other stat.
+// Generation and levelling both use this, so a levelled Pokemon has the
+// same stats as one generated at its level with the same IVs.
+int statForLevel(stat_t stat, int base, int iv, int level);
+
+// Give a freshly built Pokemon its species' growth rate and the experience
+// floor of its current level
+void startExperience(PokeData& pokemon);
+
+// Experience for knocking out defeated in a trainer battle
+int battleExperience(const PokeData& defeated);
+
+// Add exp to pokemon and apply any level-ups it earns; each stat grows by
+// the difference of statForLevel between the old and new level rather than
+// being rebuilt, so damage taken in battle carries over.  Returns the number of levels gained.
+int gainExperience(PokeData& pokemon, int exp);
+
+#endif // EXPERIENCE_H
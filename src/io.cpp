@@ -119,8 +119,8 @@ static int compare_trainer_distance(const void *v1, const void *v2)
   const character *const *c1 = (const character *const *)v1;
   const character *const *c2 = (const character *const *)v2;
 
-  return (world.rival_dist[(*c1)->pos[dim_y]][(*c1)->pos[dim_x]] -
-          world.rival_dist[(*c2)->pos[dim_y]][(*c2)->pos[dim_x]]);
+  return (world.dist[char_rival][(*c1)->pos[dim_y]][(*c1)->pos[dim_x]] -
+          world.dist[char_rival][(*c2)->pos[dim_y]][(*c2)->pos[dim_x]]);
 }
 
 static character *io_nearest_visible_trainer()
@@ -146,7 +146,7 @@ static character *io_nearest_visible_trainer()
   /* Sort it by distance from PC */
   qsort(c, count, sizeof(*c), compare_trainer_distance);
 
-  n = c[0];
+  n = count ? c[0] : NULL;
 
   free(c);
 
@@ -283,7 +283,7 @@ uint32_t io_teleport_pc(pair_t dest)
            move_cost[char_pc][world.cur_map->map[dest[dim_y]]
                                                 [dest[dim_x]]] ==
                DIJKSTRA_PATH_MAX ||
-           world.rival_dist[dest[dim_y]][dest[dim_x]] < 0);
+           world.dist[char_rival][dest[dim_y]][dest[dim_x]] < 0);
 
   return 0;
 }
@@ -522,25 +522,11 @@ void io_display_battle_options()
 void io_battle(character *aggressor, character *defender)
 {
   int choice = 3;
-  // Lambda to find the HP stat
-  auto findHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
-  {
-    for (const auto &stat : stats)
-    {
-      if (stat.getStatIdentifier() == "hp")
-      {
-        return &stat;
-      }
-    }
-    return nullptr; // HP stat not found
-  };
-
-  auto allPokemonsDefeated = [findHP](const std::vector<PokeData> &pokemons) -> bool
+  auto allPokemonsDefeated = [](const std::vector<PokeData> &pokemons) -> bool
   {
     for (const auto &pokemon : pokemons)
     {
-      const PokeStats *hpStat = findHP(pokemon.getStatsList());
-      if (hpStat && hpStat->getStatRating() > 0)
+      if (pokemon.hasStat(stat_hp) && pokemon.getHP() > 0)
       {
         return false; // At least one Pokémon is still standing
       }
@@ -548,12 +534,11 @@ void io_battle(character *aggressor, character *defender)
     return true; // All Pokémon are defeated
   };
 
-  auto selectNextAvailablePokemon = [findHP](std::vector<PokeData> &pokemons) -> PokeData *
+  auto selectNextAvailablePokemon = [](std::vector<PokeData> &pokemons) -> PokeData *
   {
     for (auto &pokemon : pokemons)
     {
-      const PokeStats *hpStat = findHP(pokemon.getStatsList());
-      if (hpStat && hpStat->getStatRating() > 0)
+      if (pokemon.hasStat(stat_hp) && pokemon.getHP() > 0)
       {
         return &pokemon;
       }
@@ -580,8 +565,11 @@ void io_battle(character *aggressor, character *defender)
   // Ensure both PC and NPC are correctly identified before proceeding
   if (playerCharacter && nonPlayerCharacter)
   {
-    srand(time(0)); // Seed the random number generator
-
+    if (world.headless)
+    {
+      autoBattle(playerCharacter, nonPlayerCharacter);
+      return;
+    }
     while (true)
     {
       if (allPokemonsDefeated(playerCharacter->getPokemons()) || allPokemonsDefeated(nonPlayerCharacter->getPokemons()))
@@ -687,46 +675,26 @@ void io_pokemon_battle_screen(pc *playerCharacter, PokeData *playerPokemon, npc
 {
   bool battleOver = false;
 
-  auto findHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
-  {
-    for (const auto &stat : stats)
-    {
-      if (stat.getStatIdentifier() == "hp")
-      {
-        return &stat;
-      }
-    }
-    return nullptr; // HP stat not found
-  };
-
-  auto findMaxHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
-  {
-    for (const auto &stat : stats)
-    {
-      if (stat.getStatIdentifier() == "maxHP")
-      {
-        return &stat;
-      }
-    }
-    return nullptr; // maxHP stat not found
-  };
-
   while (!battleOver)
   {
-    const PokeStats *playerHPStat = findHP(playerPokemon->getStatsList());
-    const PokeStats *npcHPStat = findHP(nonPlayerPokemon->getStatsList());
-    const PokeStats *playerMaxHPStat = findMaxHP(playerPokemon->getStatsList());
-    const PokeStats *npcMaxHPStat = findMaxHP(nonPlayerPokemon->getStatsList());
-    if (playerHPStat->getStatRating() <= 0 || npcHPStat->getStatRating() <= 0)
+    if (playerPokemon->getHP() <= 0 || nonPlayerPokemon->getHP() <= 0)
     {
       battleOver = true;
-      if (playerHPStat->getStatRating() <= 0)
+      if (playerPokemon->getHP() <= 0)
       {
         mvprintw(9, 2, "Your Pokemon has been defeated. Press any key to continue.");
       }
       else
       {
-        mvprintw(9, 2, "NPC's Pokemon has been defeated. Press any key to continue.");
+        int exp = battleExperience(*nonPlayerPokemon);
+        int levels = gainExperience(*playerPokemon, exp);
+        mvprintw(9, 2, "NPC's Pokemon has been defeated. %s gained %d exp.",
+                 playerPokemon->getPokemon().getIdentifier().c_str(), exp);
+        if (levels > 0)
+        {
+          mvprintw(10, 2, "%s grew to level %d!", playerPokemon->getPokemon().getIdentifier().c_str(), playerPokemon->getLevel());
+        }
+        mvprintw(11, 2, "Press any key to continue.");
       }
       refresh();
       getch(); // Wait for player input to continue
@@ -740,9 +708,9 @@ void io_pokemon_battle_screen(pc *playerCharacter, PokeData *playerPokemon, npc
     mvprintw(3, 2, "Player's Pokemon:");
     mvprintw(4, 2, "Name: %s", playerPokemon->getPokemon().getIdentifier().c_str());
     mvprintw(5, 2, "Level: %d", playerPokemon->getLevel());
-    if (playerHPStat && playerMaxHPStat)
+    if (playerPokemon->hasStat(stat_hp) && playerPokemon->hasStat(stat_max_hp))
     {
-      mvprintw(6, 2, "HP: %d/%d", playerHPStat->getStatRating(), playerMaxHPStat->getStatRating());
+      mvprintw(6, 2, "HP: %d/%d", playerPokemon->getHP(), playerPokemon->getMaxHP());
     }
     else
     {
@@ -756,9 +724,9 @@ void io_pokemon_battle_screen(pc *playerCharacter, PokeData *playerPokemon, npc
     mvprintw(3, 40, "NPC's Pokemon:");
     mvprintw(4, 40, "Name: %s", nonPlayerPokemon->getPokemon().getIdentifier().c_str());
     mvprintw(5, 40, "Level: %d", nonPlayerPokemon->getLevel());
-    if (npcHPStat && npcMaxHPStat)
+    if (nonPlayerPokemon->hasStat(stat_hp) && nonPlayerPokemon->hasStat(stat_max_hp))
     {
-      mvprintw(6, 40, "HP: %d/%d", npcHPStat->getStatRating(), npcMaxHPStat->getStatRating());
+      mvprintw(6, 40, "HP: %d/%d", nonPlayerPokemon->getHP(), nonPlayerPokemon->getMaxHP());
     }
     else
     {
@@ -786,7 +754,8 @@ void io_pokemon_battle_screen(pc *playerCharacter, PokeData *playerPokemon, npc
     case '3': // Player chooses to switch pokemon
       // Implement switching functionality here
       playerPokemon = io_pokemon_list(playerCharacter);
-      processNPCMoveSwitch(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon);
+      if (playerPokemon)
+        processNPCMoveSwitch(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon);
       break;
     case 27: // ESC key, player chooses to flee or end the battle
       battleOver = true;
@@ -803,7 +772,7 @@ void io_battle_moves(pc *playerCharacter, PokeData *playerPokemon, npc *nonPlaye
   bool moveChosen = false;
   size_t currentMoveIndex = 0; // Start with the first move in the list
 
-  if (!playerPokemon->getMovesList().empty())
+  if (playerPokemon->getMoveCount())
   {
     while (!moveChosen)
     {
@@ -815,9 +784,9 @@ void io_battle_moves(pc *playerCharacter, PokeData *playerPokemon, npc *nonPlaye
       mvprintw(3, 19, "Use UP/DOWN to toggle. Hit ENTER to choose. ESC to cancel.");
 
       // Loop through and display each move
-      for (size_t i = 0; i < playerPokemon->getMovesList().size(); ++i)
+      for (size_t i = 0; i < playerPokemon->getMoveCount(); ++i)
       {
-        const Moves &move = playerPokemon->getMovesList().at(i);
+        const Moves &move = playerPokemon->getMove(i);
         // Highlight the current move
         if (i == currentMoveIndex)
         {
@@ -829,9 +798,16 @@ void io_battle_moves(pc *playerCharacter, PokeData *playerPokemon, npc *nonPlaye
         // Display additional move details for the currently highlighted move
         if (i == currentMoveIndex)
         {
-          mvprintw(5 + playerPokemon->getMovesList().size() + 1, 19, "Power: %s", move.getPower() == 1 ? "Non-attack type (will do one damage for now)" : std::to_string(move.getPower()).c_str());
-          mvprintw(5 + playerPokemon->getMovesList().size() + 2, 19, "PP: %d", move.getPp());
-          mvprintw(5 + playerPokemon->getMovesList().size() + 3, 19, "Accuracy: %s", move.getAccuracy() == -1 ? "N/A" : (std::to_string(move.getAccuracy()) + "%").c_str());
+          mvprintw(5 + playerPokemon->getMoveCount() + 1, 19, "Power: %s", move.getPower() == 1 ? "Non-attack type (will do one damage for now)" : std::to_string(move.getPower()).c_str());
+          if (playerPokemon->getPp(i) == MOVE_PP_UNLIMITED)
+          {
+            mvprintw(5 + playerPokemon->getMoveCount() + 2, 19, "PP: --");
+          }
+          else
+          {
+            mvprintw(5 + playerPokemon->getMoveCount() + 2, 19, "PP: %d/%d", playerPokemon->getPp(i), MoveSlot::fullPp(move));
+          }
+          mvprintw(5 + playerPokemon->getMoveCount() + 3, 19, "Accuracy: %s", move.getAccuracy() == -1 ? "N/A" : (std::to_string(move.getAccuracy()) + "%").c_str());
         }
       }
 
@@ -847,14 +823,21 @@ void io_battle_moves(pc *playerCharacter, PokeData *playerPokemon, npc *nonPlaye
         }
         break;
       case KEY_DOWN:
-        if (currentMoveIndex < playerPokemon->getMovesList().size() - 1)
+        if (currentMoveIndex < playerPokemon->getMoveCount() - 1)
         {
           currentMoveIndex++;
         }
         break;
       case '\n': // ENTER key
       {
-        const Moves &chosenMove = playerPokemon->getMovesList().at(currentMoveIndex);
+        if (playerPokemon->getPp(currentMoveIndex) == 0)
+        {
+          mvprintw(0, 0, "There is no PP left for this move! Press a key to continue.");
+          refresh();
+          getch();
+          break;
+        }
+        const Moves &chosenMove = playerPokemon->getMove(currentMoveIndex);
         processMove(playerCharacter, playerPokemon, nonPlayerCharacter, nonPlayerPokemon, &chosenMove);
         moveChosen = true;
       }
@@ -930,7 +913,7 @@ void io_display_move_results(const Moves *pcMove, const Moves *npcMove, int npcD
 
   // Display the header for the player's move results
   mvprintw(3, 2, "Your Move:");
-  mvprintw(4, 2, "%s", pcMove->getIdentifier().c_str());
+  mvprintw(4, 2, "%s", pcMove ? pcMove->getIdentifier().c_str() : "(no move)");
 
   // Display the player's move outcome
   if (pcHit)
@@ -944,7 +927,7 @@ void io_display_move_results(const Moves *pcMove, const Moves *npcMove, int npcD
 
   // Display the header for the NPC's move results
   mvprintw(3, 40, "Opponent's Move:");
-  mvprintw(4, 40, "%s", npcMove->getIdentifier().c_str());
+  mvprintw(4, 40, "%s", npcMove ? npcMove->getIdentifier().c_str() : "(no move)");
 
   // Display the NPC's move outcome
   if (npcHit)
@@ -978,7 +961,7 @@ void io_display_switch_results(const Moves *npcMove, int npcDam, bool npcCrit, b
 
   // Display the header for the NPC's move results
   mvprintw(3, 40, "Opponent's Move:");
-  mvprintw(4, 40, "%s", npcMove->getIdentifier().c_str());
+  mvprintw(4, 40, "%s", npcMove ? npcMove->getIdentifier().c_str() : "(no move)");
 
   // Display the NPC's move outcome
   if (npcHit)
@@ -1016,7 +999,7 @@ void io_display_potion_results(int healthRegen, const Moves *npcMove, int npcDam
 
   // Display the header for the NPC's move results
   mvprintw(3, 40, "Opponent's Move:");
-  mvprintw(4, 40, "%s", npcMove->getIdentifier().c_str());
+  mvprintw(4, 40, "%s", npcMove ? npcMove->getIdentifier().c_str() : "(no move)");
 
   // Display the NPC's move outcome
   if (npcHit)
@@ -1051,7 +1034,7 @@ void io_display_revive_results(const Moves *npcMove, int npcDam, bool npcCrit, b
 
   // Display the header for the NPC's move results
   mvprintw(3, 40, "Opponent's Move:");
-  mvprintw(4, 40, "%s", npcMove->getIdentifier().c_str());
+  mvprintw(4, 40, "%s", npcMove ? npcMove->getIdentifier().c_str() : "(no move)");
 
   // Display the NPC's move outcome
   if (npcHit)
@@ -1088,17 +1071,9 @@ PokeData *io_pokemon_list(character *aggressor)
     return nullptr;
   }
 
-  // Lambda to find the HP stat
-  auto findHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
+  auto hasHP = [](const PokeData &pokemon)
   {
-    for (const auto &stat : stats)
-    {
-      if (stat.getStatIdentifier() == "hp")
-      {
-        return &stat;
-      }
-    }
-    return nullptr; // HP stat not found
+    return pokemon.hasStat(stat_hp) && pokemon.getHP() > 0;
   };
 
   // Find the first Pokemon with HP > 0
@@ -1106,8 +1081,7 @@ PokeData *io_pokemon_list(character *aggressor)
   bool foundActivePokemon = false;
   for (; currentPokemonIndex < n->getPokemons().size(); ++currentPokemonIndex)
   {
-    const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-    if (hpStat && hpStat->getStatRating() > 0)
+    if (hasHP(n->getPokemons()[currentPokemonIndex]))
     {
       foundActivePokemon = true;
       break; // Found a Pokemon with HP > 0, break out of the loop
@@ -1143,8 +1117,7 @@ PokeData *io_pokemon_list(character *aggressor)
       if (currentPokemonIndex > 0)
       {
         currentPokemonIndex--;
-        const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-        if (!(hpStat && hpStat->getStatRating() > 0))
+        if (!hasHP(n->getPokemons()[currentPokemonIndex]))
         {
           currentPokemonIndex++; // Skip fainted Pokemon
         }
@@ -1154,16 +1127,14 @@ PokeData *io_pokemon_list(character *aggressor)
       if (currentPokemonIndex < n->getPokemons().size() - 1)
       {
         currentPokemonIndex++;
-        const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-        if (!(hpStat && hpStat->getStatRating() > 0))
+        if (!hasHP(n->getPokemons()[currentPokemonIndex]))
         {
           currentPokemonIndex--; // Skip fainted Pokemon
         }
       }
       break;
     case '\n':
-      const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-      if (hpStat && hpStat->getStatRating() > 0)
+      if (hasHP(n->getPokemons()[currentPokemonIndex]))
       {
         return &(n->getPokemons()[currentPokemonIndex]);
       }
@@ -1185,17 +1156,9 @@ PokeData *io_pokemon_fainted_list(character *aggressor)
     return nullptr;
   }
 
-  // Lambda to find the HP stat
-  auto findHP = [](const std::vector<PokeStats> &stats) -> const PokeStats *
+  auto isOut = [](const PokeData &pokemon)
   {
-    for (const auto &stat : stats)
-    {
-      if (stat.getStatIdentifier() == "hp")
-      {
-        return &stat;
-      }
-    }
-    return nullptr; // HP stat not found
+    return pokemon.hasStat(stat_hp) && pokemon.getHP() == 0;
   };
 
   std::vector<PokeData>::size_type currentPokemonIndex = 0;
@@ -1204,8 +1167,7 @@ PokeData *io_pokemon_fainted_list(character *aggressor)
   // Find the first fainted Pokemon
   for (; currentPokemonIndex < n->getPokemons().size(); ++currentPokemonIndex)
   {
-    const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-    if (hpStat && hpStat->getStatRating() == 0)
+    if (isOut(n->getPokemons()[currentPokemonIndex]))
     {
       foundFaintedPokemon = true;
       break; // Found a fainted Pokemon, break out of the loop
@@ -1241,8 +1203,7 @@ PokeData *io_pokemon_fainted_list(character *aggressor)
       if (currentPokemonIndex > 0)
       {
         currentPokemonIndex--;
-        const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-        if (!(hpStat && hpStat->getStatRating() == 0))
+        if (!isOut(n->getPokemons()[currentPokemonIndex]))
         {
           currentPokemonIndex++; // Skip non-fainted Pokemon
         }
@@ -1252,16 +1213,14 @@ PokeData *io_pokemon_fainted_list(character *aggressor)
       if (currentPokemonIndex < n->getPokemons().size() - 1)
       {
         currentPokemonIndex++;
-        const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-        if (!(hpStat && hpStat->getStatRating() == 0))
+        if (!isOut(n->getPokemons()[currentPokemonIndex]))
         {
           currentPokemonIndex--; // Skip non-fainted Pokemon
         }
       }
       break;
     case '\n':
-      const PokeStats *hpStat = findHP(n->getPokemons()[currentPokemonIndex].getStatsList());
-      if (hpStat && hpStat->getStatRating() == 0)
+      if (isOut(n->getPokemons()[currentPokemonIndex]))
       {
         return &(n->getPokemons()[currentPokemonIndex]);
       }
@@ -1533,7 +1492,7 @@ void io_display_found_pokemon(pc *playerCharacter, PokeData &data)
   int maxHeight = 6; // Adjust based on the number of lines you will print, increased for shiny status
 
   // Check if there are moves to print
-  if (data.getMovesList().empty())
+  if (!data.getMoveCount())
   {
     mvprintw(7, 19, "No moves learned.");
     maxHeight += 1;
@@ -1542,12 +1501,13 @@ void io_display_found_pokemon(pc *playerCharacter, PokeData &data)
   {
     mvprintw(7, 19, "Moves:");
     int line = 8; // Adjusted line number for moves
-    for (const auto &move : data.getMovesList())
+    for (size_t i = 0; i < data.getMoveCount(); i++)
     {
+      const Moves &move = data.getMove(i);
       maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + move.getIdentifier().length()));
       mvprintw(line++, 19, " - %s", move.getIdentifier().c_str());
     }
-    maxHeight += data.getMovesList().size() + 1;
+    maxHeight += data.getMoveCount() + 1;
   }
 
   // Check if there are stats to print
@@ -1557,8 +1517,8 @@ void io_display_found_pokemon(pc *playerCharacter, PokeData &data)
     int line = maxHeight + 4; // Adjusted line number for stats
     for (const auto &stat : data.getStatsList())
     {
-      maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + stat.getStatIdentifier().length() + std::to_string(stat.getStatRating()).length()));
-      mvprintw(line++, 19, " - %s: %d, IV: %d", stat.getStatIdentifier().c_str(), stat.getStatRating(), stat.getIV());
+      maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + strlen(stat.getStatIdentifier()) + std::to_string(stat.getStatRating()).length()));
+      mvprintw(line++, 19, " - %s: %d, IV: %d", stat.getStatIdentifier(), stat.getStatRating(), stat.getIV());
     }
     maxHeight += data.getStatsList().size() + 1;
   }
@@ -1613,10 +1573,14 @@ void io_display_pokemon(const PokeData &data)
 
   // Initialize maxWidth with the width of static text
   int maxWidth = static_cast<int>(strlen("Name: ") + data.getPokemon().getIdentifier().length());
-  maxWidth = std::max(maxWidth, static_cast<int>(strlen("Level: ") + std::to_string(data.getLevel()).length()));
+  const ExperienceList *experience = pokedex.experience();
+  int toNext = experience ? experience->expToNextLevel(data.getGrowthRate(), data.getLevel(), data.getExp()) : 0;
+  char levelText[64];
+  snprintf(levelText, sizeof(levelText), "Level: %d (%d exp to next)", data.getLevel(), toNext);
+  maxWidth = std::max(maxWidth, static_cast<int>(strlen(levelText)));
 
   // Display Pokemon information
-  mvprintw(3, 19, "Level: %d", data.getLevel());
+  mvprintw(3, 19, "%s", levelText);
   mvprintw(4, 19, "Name: %s", data.getPokemon().getIdentifier().c_str());
 
   // Display if the Pokemon is shiny
@@ -1626,7 +1590,7 @@ void io_display_pokemon(const PokeData &data)
   int maxHeight = 6; // Adjust based on the number of lines you will print, increased for shiny status
 
   // Check if there are moves to print
-  if (data.getMovesList().empty())
+  if (!data.getMoveCount())
   {
     mvprintw(7, 19, "No moves learned.");
     maxHeight += 1;
@@ -1635,12 +1599,13 @@ void io_display_pokemon(const PokeData &data)
   {
     mvprintw(7, 19, "Moves:");
     int line = 8; // Adjusted line number for moves
-    for (const auto &move : data.getMovesList())
+    for (size_t i = 0; i < data.getMoveCount(); i++)
     {
+      const Moves &move = data.getMove(i);
       maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + move.getIdentifier().length()));
       mvprintw(line++, 19, " - %s", move.getIdentifier().c_str());
     }
-    maxHeight += data.getMovesList().size() + 1;
+    maxHeight += data.getMoveCount() + 1;
   }
 
   // Check if there are stats to print
@@ -1650,8 +1615,8 @@ void io_display_pokemon(const PokeData &data)
     int line = maxHeight + 4;              // Adjusted line number for stats
     for (const auto &stat : data.getStatsList())
     {
-      maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + stat.getStatIdentifier().length() + std::to_string(stat.getStatRating()).length()));
-      mvprintw(line++, 19, " - %s: %d", stat.getStatIdentifier().c_str(), stat.getStatRating());
+      maxWidth = std::max(maxWidth, static_cast<int>(19 + strlen(" - ") + strlen(stat.getStatIdentifier()) + std::to_string(stat.getStatRating()).length()));
+      mvprintw(line++, 19, " - %s: %d", stat.getStatIdentifier(), stat.getStatRating());
     }
     maxHeight += data.getStatsList().size() + 1;
   }
@@ -1703,16 +1668,16 @@ void io_display_choose_starter_pokemon(const std::vector<PokeData> &startingPoke
     // Print the Pokemon's moves
     mvprintw(4, 0, "Moves:");
     int line = 5;
-    for (const auto &move : pokemon.getMovesList())
+    for (size_t i = 0; i < pokemon.getMoveCount(); i++)
     {
-      mvprintw(line++, 0, " - %s", move.getIdentifier().c_str());
+      mvprintw(line++, 0, " - %s", pokemon.getMove(i).getIdentifier().c_str());
     }
 
     // Print the Pokemon's stats and IVs
     mvprintw(line++, 0, "Stats:");
     for (const auto &stat : pokemon.getStatsList())
     {
-      mvprintw(line++, 0, " - %s: %d, IV: %d", stat.getStatIdentifier().c_str(), stat.getStatRating(), stat.getIV());
+      mvprintw(line++, 0, " - %s: %d, IV: %d", stat.getStatIdentifier(), stat.getStatRating(), stat.getIV());
     }
 
     // Display instructions for choosing a Pokemon
@@ -0,0 +1,179 @@
+#include <string.h>
+
+#include "path_queue.h"
+
+void dial_queue::clear()
+{
+  memset(head, -1, sizeof (head));
+  memset(queued, 0, sizeof (queued));
+  current = 0;
+  count = 0;
+}
+
+void dial_queue::unlink(int cell)
+{
+  if (prev[cell] < 0) {
+    head[key[cell] & (DIAL_BUCKETS - 1)] = next[cell];
+  } else {
+    next[prev[cell]] = next[cell];
+  }
+  if (next[cell] >= 0) {
+    prev[next[cell]] = prev[cell];
+  }
+  queued[cell] = 0;
+  count--;
+}
+
+void dial_queue::push(int cell, int32_t k)
+{
+  int b;
+
+  if (queued[cell]) {
+    unlink(cell);
+  }
+  b = k & (DIAL_BUCKETS - 1);
+  key[cell] = k;
+  prev[cell] = -1;
+  next[cell] = head[b];
+  if (head[b] >= 0) {
+    prev[head[b]] = cell;
+  }
+  head[b] = cell;
+  queued[cell] = 1;
+  count++;
+}
+
+int dial_queue::pop()
+{
+  int cell;
+
+  if (!count) {
+    return -1;
+  }
+  while (head[current & (DIAL_BUCKETS - 1)] < 0) {
+    current++;
+  }
+  cell = head[current & (DIAL_BUCKETS - 1)];
+  unlink(cell);
+
+  return cell;
+}
+
+void radix_queue::clear()
+{
+  memset(head, -1, sizeof (head));
+  memset(bucket, -1, sizeof (bucket));
+  last = 0;
+  count = 0;
+}
+
+void radix_queue::link(int cell, int b)
+{
+  bucket[cell] = b;
+  prev[cell] = -1;
+  next[cell] = head[b];
+  if (head[b] >= 0) {
+    prev[head[b]] = cell;
+  }
+  head[b] = cell;
+}
+
+void radix_queue::unlink(int cell)
+{
+  if (prev[cell] < 0) {
+    head[bucket[cell]] = next[cell];
+  } else {
+    next[prev[cell]] = next[cell];
+  }
+  if (next[cell] >= 0) {
+    prev[next[cell]] = prev[cell];
+  }
+  bucket[cell] = -1;
+}
+
+void radix_queue::push(int cell, uint32_t k)
+{
+  if (bucket[cell] >= 0) {
+    unlink(cell);
+  } else {
+    count++;
+  }
+  key[cell] = k;
+  link(cell, bucket_for(k));
+}
+
+int radix_queue::pop()
+{
+  int b, cell, n;
+  uint32_t min;
+
+  if (!count) {
+    return -1;
+  }
+  if (head[0] < 0) {
+    /* Move the lowest non-empty bucket down around its least key */
+    for (b = 1; head[b] < 0; b++)
+      ;
+    for (min = UINT32_MAX, cell = head[b]; cell >= 0; cell = next[cell]) {
+      if (key[cell] < min) {
+        min = key[cell];
+      }
+    }
+    last = min;
+    for (cell = head[b]; cell >= 0; cell = n) {
+      n = next[cell];
+      link(cell, bucket_for(key[cell]));
+    }
+    head[b] = -1;
+  }
+  cell = head[0];
+  unlink(cell);
+  count--;
+
+  return cell;
+}
+
+int32_t fibonacci_queue::compare(const void *key, const void *with)
+{
+  return ((const entry *) key)->key - ((const entry *) with)->key;
+}
+
+fibonacci_queue::fibonacci_queue()
+{
+  heap_init(&h, compare, NULL);
+  memset(cells, 0, sizeof (cells));
+}
+
+fibonacci_queue::~fibonacci_queue()
+{
+  heap_delete(&h);
+}
+
+void fibonacci_queue::clear()
+{
+  heap_delete(&h);
+  heap_init(&h, compare, NULL);
+  memset(cells, 0, sizeof (cells));
+}
+
+void fibonacci_queue::push(int cell, int32_t k)
+{
+  cells[cell].key = k;
+  if (cells[cell].hn) {
+    heap_decrease_key_no_replace(&h, cells[cell].hn);
+  } else {
+    cells[cell].hn = heap_insert(&h, &cells[cell]);
+  }
+}
+
+int fibonacci_queue::pop()
+{
+  entry *e;
+
+  if (!(e = (entry *) heap_remove_min(&h))) {
+    return -1;
+  }
+  e->hn = NULL;
+
+  return e - cells;
+}
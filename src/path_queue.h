@@ -0,0 +1,98 @@
+#ifndef PATH_QUEUE_H
+# define PATH_QUEUE_H
+
+# include <cstdint>
+
+# include "heap.h"
+# include "poke_main.h"
+
+/* Priority queues of map cells for the shortest-path code.  A cell is *
+ * queued by its index, y * MAP_X + x; pushing a queued cell again     *
+ * moves it to the new key.  Keys must never be less than the last one *
+ * popped, which holds for Dijkstra with non-negative edges.  Each     *
+ * queue is a fixed-size object, so nothing is allocated per cell.     */
+
+# define PATH_QUEUE_CELLS (MAP_X * MAP_Y)
+# define path_cell(x, y) ((y) * MAP_X + (x))
+
+/* Dial's algorithm: a ring of buckets, one per key, wide enough that  *
+ * every queued key is within DIAL_BUCKETS - 1 of the last one popped. *
+ * Suits the distance maps, whose edges are move_cost entries.         */
+# define DIAL_BUCKETS 64
+
+class dial_queue {
+ private:
+  int16_t head[DIAL_BUCKETS];
+  int16_t next[PATH_QUEUE_CELLS];
+  int16_t prev[PATH_QUEUE_CELLS];
+  int32_t key[PATH_QUEUE_CELLS];
+  uint8_t queued[PATH_QUEUE_CELLS];
+  int32_t current;
+  uint32_t count;
+
+  void unlink(int cell);
+
+ public:
+  dial_queue() { clear(); }
+  void clear();
+  bool empty() const { return !count; }
+  void push(int cell, int32_t k);
+  /* The cell with the least key, or -1 if empty */
+  int pop();
+};
+
+/* Radix heap: bucket i holds keys whose highest bit differing from    *
+ * the last key popped is bit i - 1, so any key range works and each   *
+ * cell moves down at most 32 times.  Suits the road builder, whose    *
+ * costs multiply at the map edge.                                     */
+# define RADIX_BUCKETS 33
+
+class radix_queue {
+ private:
+  int16_t head[RADIX_BUCKETS];
+  int16_t next[PATH_QUEUE_CELLS];
+  int16_t prev[PATH_QUEUE_CELLS];
+  int8_t bucket[PATH_QUEUE_CELLS];   /* -1 when not queued */
+  uint32_t key[PATH_QUEUE_CELLS];
+  uint32_t last;
+  uint32_t count;
+
+  int bucket_for(uint32_t k) const {
+    return k == last ? 0 : 32 - __builtin_clz(k ^ last);
+  }
+  void link(int cell, int b);
+  void unlink(int cell);
+
+ public:
+  radix_queue() { clear(); }
+  void clear();
+  bool empty() const { return !count; }
+  void push(int cell, uint32_t k);
+  int pop();
+};
+
+/* The same interface over the Fibonacci heap in heap.c, one node      *
+ * allocated per push; kept as the baseline for --bench-paths.         */
+class fibonacci_queue {
+ private:
+  struct entry {
+    heap_node_t *hn;
+    int32_t key;
+  };
+  heap_t h;
+  entry cells[PATH_QUEUE_CELLS];
+
+  static int32_t compare(const void *key, const void *with);
+
+ public:
+  fibonacci_queue();
+  ~fibonacci_queue();
+  fibonacci_queue(const fibonacci_queue &) = delete;
+  fibonacci_queue &operator=(const fibonacci_queue &) = delete;
+  void clear();
+  bool empty() const { return !h.size; }
+  void push(int cell, int32_t k);
+  int pop();
+};
+
+#endif
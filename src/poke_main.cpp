@@ -9,7 +9,6 @@
 #include <assert.h>
 #include <unistd.h>
 #include <algorithm> // For std::shuffle
-#include <random>    // For std::default_random_engine
 
 #include <fstream>
 #include <iostream>
@@ -23,14 +22,15 @@
 #include "io.h"
 #include "data.h"
 #include "prints.h"
+#include "pokedex.h"
+#include "battle_ai.h"
+#include "balance.h"
+#include "roster_pool.h"
+#include "experience.h"
+#include "path_queue.h"
+#include "threadpool.h"
 
 
-// File-scope static variables
-static PokemonMovesList* pokemonMovesObjectList = nullptr;
-static MovesList* movesObjectList = nullptr;
-static StatsList* statsObjectList = nullptr;
-static PokemonStatsList* pokemonStatsObjectList = nullptr;
-
 typedef struct queue_node {
   int x, y;
   struct queue_node *next;
@@ -40,6 +40,16 @@ typedef struct queue_node {
  * large thing to put on the stack.  To avoid that, world is a global.     */
 class world world;
 
+const char *stat_name[num_stats] = {
+  "hp",
+  "attack",
+  "defense",
+  "special-attack",
+  "special-defense",
+  "speed",
+  "maxHP"
+};
+
 pair_t all_dirs[8] = {
   { -1, -1 },
   { -1,  0 },
@@ -51,21 +61,24 @@ pair_t all_dirs[8] = {
   {  1,  1 },
 };
 
-static int32_t path_cmp(const void *key, const void *with) {
-  return ((path_t *) key)->cost - ((path_t *) with)->cost;
-}
-
 static int32_t edge_penalty(int8_t x, int8_t y)
 {
   return (x == 1 || y == 1 || x == MAP_X - 2 || y == MAP_Y - 2) ? 2 : 1;
 }
 
-static void dijkstra_path(map *m, pair_t from, pair_t to)
+/* Lay the cheapest road from `from` to `to`.  Stepping off a cell costs *
+ * its height, and the running cost doubles on cells along the edge of  *
+ * the map; it saturates rather than overflow on long runs down an edge. */
+template <class queue>
+static void dijkstra_path(map *m, pair_t from, pair_t to, queue &q)
 {
+  static const int8_t road_dirs[4][2] = {
+    {  0, -1 }, { -1,  0 }, {  1,  0 }, {  0,  1 }
+  };
   static path_t path[MAP_Y][MAP_X], *p;
   static uint32_t initialized = 0;
-  heap_t h;
-  int32_t x, y;
+  int32_t x, y, nx, ny, i, cell;
+  int64_t cost;
 
   if (!initialized) {
     for (y = 0; y < MAP_Y; y++) {
@@ -85,16 +98,11 @@ static void dijkstra_path(map *m, pair_t from, pair_t to)
 
   path[from[dim_y]][from[dim_x]].cost = 0;
 
-  heap_init(&h, path_cmp, NULL);
+  q.clear();
+  q.push(path_cell(from[dim_x], from[dim_y]), 0);
 
-  for (y = 1; y < MAP_Y - 1; y++) {
-    for (x = 1; x < MAP_X - 1; x++) {
-      path[y][x].hn = heap_insert(&h, &path[y][x]);
-    }
-  }
-
-  while ((p = (path_t *) heap_remove_min(&h))) {
-    p->hn = NULL;
+  while ((cell = q.pop()) >= 0) {
+    p = &path[cell / MAP_X][cell % MAP_X];
 
     if ((p->pos[dim_y] == to[dim_y]) && p->pos[dim_x] == to[dim_x]) {
       for (x = to[dim_x], y = to[dim_y];
@@ -106,61 +114,30 @@ static void dijkstra_path(map *m, pair_t from, pair_t to)
           heightxy(x, y) = 0;
         }
       }
-      heap_delete(&h);
       return;
     }
 
-    if ((path[p->pos[dim_y] - 1][p->pos[dim_x]    ].hn) &&
-        (path[p->pos[dim_y] - 1][p->pos[dim_x]    ].cost >
-         ((p->cost + heightpair(p->pos)) *
-          edge_penalty(p->pos[dim_x], p->pos[dim_y] - 1)))) {
-      path[p->pos[dim_y] - 1][p->pos[dim_x]    ].cost =
-        ((p->cost + heightpair(p->pos)) *
-         edge_penalty(p->pos[dim_x], p->pos[dim_y] - 1));
-      path[p->pos[dim_y] - 1][p->pos[dim_x]    ].from[dim_y] = p->pos[dim_y];
-      path[p->pos[dim_y] - 1][p->pos[dim_x]    ].from[dim_x] = p->pos[dim_x];
-      heap_decrease_key_no_replace(&h, path[p->pos[dim_y] - 1]
-                                           [p->pos[dim_x]    ].hn);
-    }
-    if ((path[p->pos[dim_y]    ][p->pos[dim_x] - 1].hn) &&
-        (path[p->pos[dim_y]    ][p->pos[dim_x] - 1].cost >
-         ((p->cost + heightpair(p->pos)) *
-          edge_penalty(p->pos[dim_x] - 1, p->pos[dim_y])))) {
-      path[p->pos[dim_y]][p->pos[dim_x] - 1].cost =
-        ((p->cost + heightpair(p->pos)) *
-         edge_penalty(p->pos[dim_x] - 1, p->pos[dim_y]));
-      path[p->pos[dim_y]    ][p->pos[dim_x] - 1].from[dim_y] = p->pos[dim_y];
-      path[p->pos[dim_y]    ][p->pos[dim_x] - 1].from[dim_x] = p->pos[dim_x];
-      heap_decrease_key_no_replace(&h, path[p->pos[dim_y]    ]
-                                           [p->pos[dim_x] - 1].hn);
-    }
-    if ((path[p->pos[dim_y]    ][p->pos[dim_x] + 1].hn) &&
-        (path[p->pos[dim_y]    ][p->pos[dim_x] + 1].cost >
-         ((p->cost + heightpair(p->pos)) *
-          edge_penalty(p->pos[dim_x] + 1, p->pos[dim_y])))) {
-      path[p->pos[dim_y]][p->pos[dim_x] + 1].cost =
-        ((p->cost + heightpair(p->pos)) *
-         edge_penalty(p->pos[dim_x] + 1, p->pos[dim_y]));
-      path[p->pos[dim_y]    ][p->pos[dim_x] + 1].from[dim_y] = p->pos[dim_y];
-      path[p->pos[dim_y]    ][p->pos[dim_x] + 1].from[dim_x] = p->pos[dim_x];
-      heap_decrease_key_no_replace(&h, path[p->pos[dim_y]    ]
-                                           [p->pos[dim_x] + 1].hn);
-    }
-    if ((path[p->pos[dim_y] + 1][p->pos[dim_x]    ].hn) &&
-        (path[p->pos[dim_y] + 1][p->pos[dim_x]    ].cost >
-         ((p->cost + heightpair(p->pos)) *
-          edge_penalty(p->pos[dim_x], p->pos[dim_y] + 1)))) {
-      path[p->pos[dim_y] + 1][p->pos[dim_x]    ].cost =
-        ((p->cost + heightpair(p->pos)) *
-         edge_penalty(p->pos[dim_x], p->pos[dim_y] + 1));
-      path[p->pos[dim_y] + 1][p->pos[dim_x]    ].from[dim_y] = p->pos[dim_y];
-      path[p->pos[dim_y] + 1][p->pos[dim_x]    ].from[dim_x] = p->pos[dim_x];
-      heap_decrease_key_no_replace(&h, path[p->pos[dim_y] + 1]
-                                           [p->pos[dim_x]    ].hn);
+    for (i = 0; i < 4; i++) {
+      nx = p->pos[dim_x] + road_dirs[i][dim_x];
+      ny = p->pos[dim_y] + road_dirs[i][dim_y];
+      if (nx < 1 || nx > MAP_X - 2 || ny < 1 || ny > MAP_Y - 2) {
+        continue;
+      }
+      cost = std::min<int64_t>(((int64_t) p->cost + heightpair(p->pos)) *
+                               edge_penalty(nx, ny), INT_MAX - 1);
+      if (path[ny][nx].cost > cost) {
+        path[ny][nx].cost = cost;
+        path[ny][nx].from[dim_y] = p->pos[dim_y];
+        path[ny][nx].from[dim_x] = p->pos[dim_x];
+        q.push(path_cell(nx, ny), cost);
+      }
     }
   }
 }
 
+/* Road costs have no useful bound, so roads use a radix heap */
+static radix_queue road_queue;
+
 static int build_paths(map *m)
 {
   pair_t from, to;
@@ -173,7 +150,7 @@ static int build_paths(map *m)
     from[dim_y] = m->w;
     to[dim_y] = m->e;
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   if (m->n != -1 && m->s != -1) {
@@ -182,7 +159,7 @@ static int build_paths(map *m)
     from[dim_x] = m->n;
     to[dim_x] = m->s;
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   if (m->e == -1) {
@@ -198,7 +175,7 @@ static int build_paths(map *m)
       to[dim_y] = MAP_Y - 2;
     }
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   if (m->w == -1) {
@@ -214,7 +191,7 @@ static int build_paths(map *m)
       to[dim_y] = MAP_Y - 2;
     }
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   if (m->n == -1) {
@@ -230,7 +207,7 @@ static int build_paths(map *m)
       to[dim_y] = MAP_Y - 2;
     }
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   if (m->s == -1) {
@@ -246,7 +223,7 @@ static int build_paths(map *m)
       to[dim_y] = 1;
     }
 
-    dijkstra_path(m, from, to);
+    dijkstra_path(m, from, to, road_queue);
   }
 
   return 0;
@@ -273,8 +250,8 @@ static int smooth_height(map *m)
   /* Seed with some values */
   for (i = 1; i < 255; i += 20) {
     do {
-      x = rand() % MAP_X;
-      y = rand() % MAP_Y;
+      x = rngStream(rng_world).nextInt() % MAP_X;
+      y = rngStream(rng_world).nextInt() % MAP_Y;
     } while (height[y][x]);
     height[y][x] = i;
     if (i == 1) {
@@ -420,8 +397,8 @@ static int smooth_height(map *m)
 static void find_building_location(map *m, pair_t p)
 {
   do {
-    p[dim_x] = rand() % (MAP_X - 3) + 1;
-    p[dim_y] = rand() % (MAP_Y - 3) + 1;
+    p[dim_x] = rngStream(rng_world).nextInt() % (MAP_X - 3) + 1;
+    p[dim_y] = rngStream(rng_world).nextInt() % (MAP_Y - 3) + 1;
 
     if ((((mapxy(p[dim_x] - 1, p[dim_y]    ) == ter_path)     &&
           (mapxy(p[dim_x] - 1, p[dim_y] + 1) == ter_path))    ||
@@ -505,15 +482,15 @@ static terrain_type_t border_type(map *m, int32_t x, int32_t y)
   }
   
   if (t == r) {
-    return rand() & 1 ? ter_boulder : ter_tree;
+    return rngStream(rng_world).nextInt() & 1 ? ter_boulder : ter_tree;
   } else if (t > r) {
-    if (rand() % 10) {
+    if (rngStream(rng_world).nextInt() % 10) {
       return ter_tree;
     } else {
       return ter_boulder;
     }
   } else {
-    if (rand() % 10) {
+    if (rngStream(rng_world).nextInt() % 10) {
       return ter_boulder;
     } else {
       return ter_tree;
@@ -530,11 +507,11 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
   terrain_type_t type;
   int added_current = 0;
   
-  num_grass = rand() % 4 + 2;
-  num_clearing = rand() % 4 + 2;
-  num_mountain = rand() % 2 + 1;
-  num_forest = rand() % 2 + 1;
-  num_water = rand() % 2 + 1;
+  num_grass = rngStream(rng_world).nextInt() % 4 + 2;
+  num_clearing = rngStream(rng_world).nextInt() % 4 + 2;
+  num_mountain = rngStream(rng_world).nextInt() % 2 + 1;
+  num_forest = rngStream(rng_world).nextInt() % 2 + 1;
+  num_water = rngStream(rng_world).nextInt() % 2 + 1;
   num_total = num_grass + num_clearing + num_mountain + num_forest + num_water;
 
   memset(&m->map, 0, sizeof (m->map));
@@ -542,8 +519,8 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
   /* Seed with some values */
   for (i = 0; i < num_total; i++) {
     do {
-      x = rand() % MAP_X;
-      y = rand() % MAP_Y;
+      x = rngStream(rng_world).nextInt() % MAP_X;
+      y = rngStream(rng_world).nextInt() % MAP_Y;
     } while (m->map[y][x]);
     if (i == 0) {
       type = ter_grass;
@@ -582,7 +559,7 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
     type = m->map[y][x];
     
     if (x - 1 >= 0 && !m->map[y][x - 1]) {
-      if ((rand() % 100) < 80) {
+      if ((rngStream(rng_world).nextInt() % 100) < 80) {
         m->map[y][x - 1] = type;
         tail->next = (queue_node_t *) malloc(sizeof (*tail));
         tail = tail->next;
@@ -601,7 +578,7 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
     }
 
     if (y - 1 >= 0 && !m->map[y - 1][x]) {
-      if ((rand() % 100) < 20) {
+      if ((rngStream(rng_world).nextInt() % 100) < 20) {
         m->map[y - 1][x] = type;
         tail->next = (queue_node_t *) malloc(sizeof (*tail));
         tail = tail->next;
@@ -620,7 +597,7 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
     }
 
     if (y + 1 < MAP_Y && !m->map[y + 1][x]) {
-      if ((rand() % 100) < 20) {
+      if ((rngStream(rng_world).nextInt() % 100) < 20) {
         m->map[y + 1][x] = type;
         tail->next = (queue_node_t *) malloc(sizeof (*tail));
         tail = tail->next;
@@ -639,7 +616,7 @@ static int map_terrain(map *m, int8_t n, int8_t s, int8_t e, int8_t w)
     }
 
     if (x + 1 < MAP_X && !m->map[y][x + 1]) {
-      if ((rand() % 100) < 80) {
+      if ((rngStream(rng_world).nextInt() % 100) < 80) {
         m->map[y][x + 1] = type;
         tail->next = (queue_node_t *) malloc(sizeof (*tail));
         tail = tail->next;
@@ -709,9 +686,9 @@ static int place_boulders(map *m)
   int i;
   int x, y;
 
-  for (i = 0; i < MIN_BOULDERS || rand() % 100 < BOULDER_PROB; i++) {
-    y = rand() % (MAP_Y - 2) + 1;
-    x = rand() % (MAP_X - 2) + 1;
+  for (i = 0; i < MIN_BOULDERS || rngStream(rng_world).nextInt() % 100 < BOULDER_PROB; i++) {
+    y = rngStream(rng_world).nextInt() % (MAP_Y - 2) + 1;
+    x = rngStream(rng_world).nextInt() % (MAP_X - 2) + 1;
     if (m->map[y][x] != ter_forest &&
         m->map[y][x] != ter_path   &&
         m->map[y][x] != ter_gate   &&
@@ -728,9 +705,9 @@ static int place_trees(map *m)
   int i;
   int x, y;
   
-  for (i = 0; i < MIN_TREES || rand() % 100 < TREE_PROB; i++) {
-    y = rand() % (MAP_Y - 2) + 1;
-    x = rand() % (MAP_X - 2) + 1;
+  for (i = 0; i < MIN_TREES || rngStream(rng_world).nextInt() % 100 < TREE_PROB; i++) {
+    y = rngStream(rng_world).nextInt() % (MAP_Y - 2) + 1;
+    x = rngStream(rng_world).nextInt() % (MAP_X - 2) + 1;
     if (m->map[y][x] != ter_mountain &&
         m->map[y][x] != ter_path     &&
         m->map[y][x] != ter_water    &&
@@ -745,64 +722,11 @@ static int place_trees(map *m)
 
 void rand_pos(pair_t pos)
 {
-  pos[dim_x] = (rand() % (MAP_X - 2)) + 1;
-  pos[dim_y] = (rand() % (MAP_Y - 2)) + 1;
+  pos[dim_x] = (rngStream(rng_trainer).nextInt() % (MAP_X - 2)) + 1;
+  pos[dim_y] = (rngStream(rng_trainer).nextInt() % (MAP_Y - 2)) + 1;
 }
 
 
-bool readFileFromDirectories(const std::string& relativeFilePath, std::string& fullPath) {
-    printf("trying to read path");
-    std::vector<std::string> basePaths = {
-        "/share/cs327/",
-        getenv("HOME") + std::string("/.poke327/"),
-        "/mnt/c/Users/gabri/CS/personal projects/Pokemon/DB/"
-    };
-
-    //std::string fullPath;
-    std::ifstream file;
-
-    for (const auto& basePath : basePaths) {
-        fullPath = basePath + "pokedex/pokedex/data/csv/" + relativeFilePath;
-        file.open(fullPath);
-        if (file) {
-            return true; // File was found and read
-        }
-    }
-
-   fullPath.clear(); // Clear fullPath if the file was not found
-    return false; // File was not found
-}
-
-
-
-
-DataObjectList* parseDataType(const std::string& relativeFilePath, const std::string& fullPath){
-
-  if(relativeFilePath == "pokemon.csv"){
-    
-     return new PokemonList(fullPath);
-  }else if(relativeFilePath == "moves.csv"){
-     return new MovesList(fullPath);
-  }else if(relativeFilePath == "pokemon_moves.csv"){
-     return new PokemonMovesList(fullPath);
-  }else if(relativeFilePath == "pokemon_species.csv"){
-     return new PokemonSpeciesList(fullPath);
-  }else if(relativeFilePath == "experience.csv"){
-     return new ExperienceList(fullPath);
-  }else if(relativeFilePath == "type_names.csv"){
-     return new TypeNamesList(fullPath);
-  }else if(relativeFilePath == "pokemon_stats.csv"){
-     return new PokemonStatsList(fullPath);
-  }else if(relativeFilePath == "stats.csv"){
-     return new StatsList(fullPath);
-  }else if(relativeFilePath == "pokemon_types.csv"){
-     return new PokemonTypesList(fullPath);
-  }else{
-    return nullptr;
-  }
-
-}
-
 void handleFile(const std::string& relativeFilePath){
   //check if file exists and set the string for the full path 
   std::string fullPath;
@@ -828,69 +752,31 @@ void handleFile(const std::string& relativeFilePath){
 
 }
 
-// Function to initialize the lists
+// Load every pokedex table into the resident catalog
 static void initializeDataLists() {
-    std::string fullPath;
-
-    // Initialize pokemonMovesObjectList
-    if(readFileFromDirectories("pokemon_moves.csv", fullPath)) {
-        DataObjectList* dataObjectList = parseDataType("pokemon_moves.csv", fullPath);
-        pokemonMovesObjectList = dynamic_cast<PokemonMovesList*>(dataObjectList);
-    }
-
-    // Initialize movesObjectList
-    if(readFileFromDirectories("moves.csv", fullPath)) {
-        DataObjectList* dataObjectList = parseDataType("moves.csv", fullPath);
-        movesObjectList = dynamic_cast<MovesList*>(dataObjectList);
-    }
-
-    // Initialize statsObjectList
-    if(readFileFromDirectories("stats.csv", fullPath)) {
-        DataObjectList* dataObjectList = parseDataType("stats.csv", fullPath);
-        statsObjectList = dynamic_cast<StatsList*>(dataObjectList);
-    }
-
-    // Initialize pokemonStatsObjectList
-    if(readFileFromDirectories("pokemon_stats.csv", fullPath)) {
-        DataObjectList* dataObjectList = parseDataType("pokemon_stats.csv", fullPath);
-        pokemonStatsObjectList = dynamic_cast<PokemonStatsList*>(dataObjectList);
-    }
+    pokedex.load();
 }
 
 
 
-Pokemon* getRandomPokemon(){
-  std::string fullPath;
-  if(!readFileFromDirectories("pokemon.csv", fullPath)){
+const Pokemon* getRandomPokemon(RngStream& rng){
+  const PokemonList* pokemonObjectList = pokedex.pokemon();
+  if(!pokemonObjectList){
       //printf("Pokemon file not found in any of the directories.\n");
       return nullptr;
   }
-  DataObjectList* dataObjectList = parseDataType("pokemon.csv", fullPath);
-  PokemonList* pokemonObjectList = dynamic_cast<PokemonList*>(dataObjectList);
 
   // get the size as a variable
-  const auto& pokemonList = pokemonObjectList->getObjects();
-  printf("\n");
+  const PokemonList& pokemonList = *pokemonObjectList;
   //std::cout << "The list contains " << pokemonList.size() << " Pokemon." << std::endl;
-  printf("\n");
   int size = 151;
 
-  // Seed the random number generator
-  srand(time(NULL)); // Note: Ideally, you should seed the random number generator only once at the start of the program
-
   // Now choose a random pokemon (1-size)
   // Ensure size is greater than 0 to avoid division by zero
   if (size > 0) {
-      // Create a random device and use it to seed the Mersenne Twister engine
-      std::random_device rd;
-      std::mt19937 gen(rd());
-
-      // Define the distribution to be in the range [1, size]
-      std::uniform_int_distribution<> distr(1, size);
-
     // Generate a random number in the range [1, size]
-    int randomId = distr(gen);
-      Pokemon* poke = dynamic_cast<Pokemon*>(pokemonList[randomId].get());
+    int randomId = rng.range(1, size);
+      const Pokemon* poke = pokemonList.getPokemonById(randomId);
 
       if (poke) {
          // poke->printObject();
@@ -905,33 +791,27 @@ Pokemon* getRandomPokemon(){
   return nullptr;
 }
 
-void selectMovesForPokemon(const std::vector<std::unique_ptr<DataObject>>& pokemonMoves,
-                                         const std::vector<std::unique_ptr<DataObject>>& allMoves,
-                                         PokeData* pokeData, int level) {
+void selectMovesForPokemon(const PokemonMovesList& pokemonMoves,
+                                         const MovesList& allMoves,
+                                         PokeData* pokeData, RngStream& rng) {
 
     
     std::vector<Moves> selectedMoves;
     std::vector<Moves> moves;
-    std::vector<PokemonMoves> pokeMoves;
     if (!pokeData) {
         printf("Error: pokeData is null\n");
-         // Return an empty vector or handle the error as appropriate
+        return;
     }
-    for (const auto& ptr : pokemonMoves) {
-      //printf("\nchecking\n");
-      //dynamically cast the ptr to a PokemonMove here!!
-      PokemonMoves* pokemonMove = dynamic_cast<PokemonMoves*>(ptr.get());
-      if (pokemonMove && pokemonMove->getPokemonId() == pokeData->getPokemon().getId() && pokemonMove->getLevel() <= pokeData->getLevel()) {
-          //add the move to the pokeMoves vector defined above
-          pokeMoves.push_back(*pokemonMove);
-      }
-  }
+    // Only this Pokemon's learnset is touched; a binary search on level
+    // bounds the moves it can know
+    LearnsetSpan learnable = pokemonMoves.learnableAt(pokeData->getPokemon().getId(), pokeData->getLevel());
+    std::vector<LearnsetEntry> pokeMoves(learnable.begin(), learnable.end());
    
   // Shuffle the pokeMoves vector to ensure a uniform distribution
-std::shuffle(pokeMoves.begin(), pokeMoves.end(), std::default_random_engine(std::random_device{}()));
+std::shuffle(pokeMoves.begin(), pokeMoves.end(), rng);
 
 // Create a new vector to hold the selected moves
-std::vector<PokemonMoves> selectedPokemonMoves;
+std::vector<LearnsetEntry> selectedPokemonMoves;
 
 // Check if there are at least two moves to select from
 if (pokeMoves.size() >= 2) {
@@ -947,55 +827,59 @@ if (pokeMoves.size() >= 2) {
   //printPokemonMovesList(selectedPokemonMoves);
 
   //now get the moves 
-  for (const auto& ptr : allMoves) {
-    Moves* move = dynamic_cast<Moves*>(ptr.get());
-    for (const auto& ptr2 : selectedPokemonMoves){
-      if(move->getId() == ptr2.getMoveId()){
-        //add it straight to the pokemon data
-        pokeData->addMove(*move);
-      }
+  for (const auto& ptr2 : selectedPokemonMoves){
+    const Moves* move = allMoves.findById(ptr2.moveId);
+    if(move){
+      //add it straight to the pokemon data
+      pokeData->addMove(*move);
     }
-
   }
 
 
 }
 
-void getStatsForPokemon(PokeData* data, const std::vector<std::unique_ptr<DataObject>>& stats, const std::vector<std::unique_ptr<DataObject>>& pokemonStats){
-      std::vector<PokemonStats> selectedPokemonStats;
-
-      // Create a random number generator using Mersenne Twister and a random device as the seed
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    // Define the distribution to be in the range [1, 15]
-    std::uniform_int_distribution<> distr(1, 15);
-
-      for (const auto& ptr : pokemonStats){
-        PokemonStats* pokeStats = dynamic_cast<PokemonStats*>(ptr.get());
-        if(pokeStats->getPokemonId() == data->getPokemon().getId()){
-          selectedPokemonStats.push_back(*pokeStats);
-          //now get the 
-          for (const auto& ptr2 : stats){
-            Stats* stat = dynamic_cast<Stats*>(ptr2.get());
-            if(stat->getId() == pokeStats->getStatId()){
-              int iv = distr(gen);
-              PokeStats pokeStat(stat->getIdentifier(), pokeStats->getBaseStat(), iv);
-              data->addStat(pokeStat);
-            }
-          }
-        }
-      }
-  
+void getStatsForPokemon(PokeData* data, const PokemonStatsList& pokemonStats, RngStream& rng){
+
+    // One precomputed block per species, copied whole
+    const BaseStats* base = pokemonStats.baseStats(data->getPokemon().getId());
+    if(!base){
+      return;
+    }
+    data->setBaseStats(*base);
+
+    // Base stats line up with the first NUM_BASE_STATS stat slots; the
+    // same formula levelling uses, so the level must already be set
+    for (int s = 0; s < NUM_BASE_STATS; s++){
+      data->setIV((stat_t) s, rng.range(1, 15));
+      data->setStat((stat_t) s, statForLevel((stat_t) s, base->base[s], data->getIV((stat_t) s), data->getLevel()));
+    }
+    data->setStat(stat_max_hp, data->getStat(stat_hp));
 } 
 
-PokeData* generatePokemon(int absLevel, int state){
+static int trainerPokemonLevel(int absLevel, RngStream& rng){
+  //create some variety in low levels 
+  if(absLevel <= 5){
+    return (rng.nextInt()%4)+1;
+  }
+  int min = 0.2 * absLevel;
+  int max = 0.8 * absLevel;
+
+  int level = (rng.nextInt() % max) + min;
+
+  if(level < 1){level = 1;}
+  if(level > 100){level = 100;}
+  return level;
+}
+
+PokeData generatePokemon(int absLevel, int state){
   
   std::string fullPath;
   //we have got a rnadom pokemon 
-  Pokemon* pokemon = getRandomPokemon();
+  // Trainer parties and wild encounters draw from separate streams
+  RngStream& rng = rngStream(state == 2 ? rng_trainer : rng_encounter);
+  const Pokemon* pokemon = getRandomPokemon(rng);
   
   int level;
-  srand(time(NULL)); // Note: Ideally, srand should only be called once at the start of the program
 
   //case fior a found pokemon 
   if(state == 0){
@@ -1004,63 +888,56 @@ PokeData* generatePokemon(int absLevel, int state){
       // Minimum level is 1 and maximum level is manDis / 2
       // Ensure divisor is at least 1 to avoid division by zero
       int divisor = std::max(absLevel / 2, 1);
-      level = (rand() % divisor) + 1; // Range: [1, max(1, manDis/2)]
+      level = (rng.nextInt() % divisor) + 1; // Range: [1, max(1, manDis/2)]
     } else {
       // When distance exceeds 200
       // Minimum level becomes (manDis - 200) / 2 and maximum level is 100
       int minLevel = (absLevel - 200) / 2;
       minLevel = std::max(minLevel, 1); // Ensure minimum level is at least 1
-      level = (rand() % (101 - minLevel)) + minLevel; // Range: [minLevel, 100]
+      level = (rng.nextInt() % (101 - minLevel)) + minLevel; // Range: [minLevel, 100]
     }
   }else if(state == 1){ //Case for starting Pokemon
       level = 1;
   }else{//Case for generating trainer pokemon levels
-
-      //create some variety in low levels 
-      if(absLevel <= 5){
-        level = (rand()%4)+1;
-      }else{
-        int min = 0.2 * absLevel;
-        int max = 0.8 * absLevel;
-
-        level = (rand() % max) + min;
-
-        if(level < 1){level = 1;}
-        if(level > 100){level = 100;}
-      }
+      level = trainerPokemonLevel(absLevel, rng);
   }
  
-  //get the id for the pokemon, pokemon_moves.csv, moves.csv, stats.csv
-  int pokeId = pokemon->getId();
-  PokeData* pokeData= new PokeData(); // Make sure to replace PokeData() with the appropriate constructor if needed
+  // Built in place in the caller's object
+  PokeData pokeData;
+  buildPokemon(&pokeData, *pokemon, level, rng);
+  return pokeData;
+
+}
+
+void buildPokemon(PokeData* pokeData, const Pokemon& pokemon, int level, RngStream& rng){
   pokeData->setLevel(level);
-  pokeData->setPokemon(*pokemon);
+  pokeData->setPokemon(pokemon);
   
-    selectMovesForPokemon(pokemonMovesObjectList->getObjects(), movesObjectList->getObjects(), pokeData, pokeId);
+    selectMovesForPokemon(*pokedex.pokemonMoves(), *pokedex.moves(), pokeData, rng);
   
-    getStatsForPokemon(pokeData, statsObjectList->getObjects(), pokemonStatsObjectList->getObjects());
+    getStatsForPokemon(pokeData, *pokedex.pokemonStats(), rng);
      //pokeData->printPokeData();
     //set shiny chnace to one half with shiny int 
-    std::random_device rd; // Obtain a random number from hardware
-    std::mt19937 gen(rd()); // Seed the generator
-    std::uniform_int_distribution<> distr(0, 1); // Define the range [0, 1]
-
-    int shiny = distr(gen); // Generate a random number in the range [0, 1]
+    int shiny = rng.range(0, 1); // Generate a random number in the range [0, 1]
 
     if (shiny == 1){
         pokeData->setShiny(true);
     }else{
         pokeData->setShiny(false);
     }
-  return pokeData;
-
+    startExperience(*pokeData);
 }
 
 void chooseStartingPokemon(character *c){
   std::vector<PokeData> startingPokemons;
+  startingPokemons.reserve(3);
   for(int i = 0; i<3; i++){
-      PokeData* poke = generatePokemon(0, 1); // Assuming generatePokemon returns a PokeData object
-      startingPokemons.push_back(*poke); // Add the generated Pokémon to the list
+      startingPokemons.push_back(generatePokemon(0, 1)); // Add the generated Pokémon to the list
+  }
+  if (world.headless) {
+    // Nobody to ask; take the first one
+    c->addPokemon(std::move(startingPokemons[0]));
+    return;
   }
     //now call to the terminal with the starting pokemon 
     io_display_choose_starter_pokemon(startingPokemons, *c);
@@ -1071,6 +948,23 @@ int manDisWorld(){
 
   return abs(200-x) + abs(200-y);
 }
+/* Trainer parties come ready-made from the roster pool; only their *
+ * levels are drawn here, from the map's distance to the center.    */
+static void fill_trainer_party(npc *c)
+{
+  RngStream& rng = rngStream(rng_trainer);
+  int manDis = manDisWorld();
+
+  //there is always at least one pokemon 
+  c->addPokemon(RosterPool::shared().take(trainerPokemonLevel(manDis, rng)));
+  for (int i = 0; i < 5; i++) {
+    // 60% probability to add a new Pokémon to the list
+    if (rng.chance(60)) {
+      c->addPokemon(RosterPool::shared().take(trainerPokemonLevel(manDis, rng)));
+    }
+  }
+}
+
 void new_hiker()
 {
   pair_t pos;
@@ -1078,7 +972,7 @@ void new_hiker()
 
   do {
     rand_pos(pos);
-  } while (world.hiker_dist[pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
+  } while (world.dist[char_hiker][pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
            world.cur_map->cmap[pos[dim_y]][pos[dim_x]]                   ||
            pos[dim_x] < 3 || pos[dim_x] > MAP_X - 4                      ||
            pos[dim_y] < 3 || pos[dim_y] > MAP_Y - 4);
@@ -1095,22 +989,7 @@ void new_hiker()
   c->next_turn = 0;
   c->seq_num = world.char_seq_num++;
 
-  //function to get the mnhattan distance of the world
-  int manDis = manDisWorld();
-  //create the pokemon and add them to the trainer 
-  //there is always at least one pokemon 
-  PokeData* pd = generatePokemon(manDis,2);
-  c->addPokemon(*pd);
-  std::random_device rd; // Obtain a random number from hardware
-  std::mt19937 gen(rd()); // Seed the generator
-  std::uniform_int_distribution<> distr(1, 100); // Define the range [1, 60]
-  for (int i = 0; i < 5; i++) {
-        // 60% probability to add a new Pokémon to the list
-        if (distr(gen) <= 60) { // 60% chance
-            PokeData* newPd = generatePokemon(manDis, 2);
-            c->addPokemon(*newPd); // Add the new Pokémon
-        }
-    }
+  fill_trainer_party(c);
 
   heap_insert(&world.cur_map->turn, c);
 }
@@ -1122,8 +1001,8 @@ void new_rival()
 
   do {
     rand_pos(pos);
-  } while (world.rival_dist[pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
-           world.rival_dist[pos[dim_y]][pos[dim_x]] < 0                  ||
+  } while (world.dist[char_rival][pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
+           world.dist[char_rival][pos[dim_y]][pos[dim_x]] < 0                  ||
            world.cur_map->cmap[pos[dim_y]][pos[dim_x]]                   ||
            pos[dim_x] < 3 || pos[dim_x] > MAP_X - 4                      ||
            pos[dim_y] < 3 || pos[dim_y] > MAP_Y - 4);
@@ -1141,22 +1020,7 @@ void new_rival()
   c->seq_num = world.char_seq_num++;
 
 
-  //function to get the mnhattan distance of the world
-  int manDis = manDisWorld();
-  //create the pokemon and add them to the trainer 
-  //there is always at least one pokemon 
-  PokeData* pd = generatePokemon(manDis,2);
-  c->addPokemon(*pd);
-  std::random_device rd; // Obtain a random number from hardware
-  std::mt19937 gen(rd()); // Seed the generator
-  std::uniform_int_distribution<> distr(1, 100); // Define the range [1, 60]
-  for (int i = 0; i < 5; i++) {
-        // 60% probability to add a new Pokémon to the list
-        if (distr(gen) <= 60) { // 60% chance
-            PokeData* newPd = generatePokemon(manDis, 2);
-            c->addPokemon(*newPd); // Add the new Pokémon
-        }
-    }
+  fill_trainer_party(c);
 
 
   heap_insert(&world.cur_map->turn, c);
@@ -1166,6 +1030,17 @@ void new_swimmer()
 {
   pair_t pos;
   npc *c;
+  int x, y, water = 0;
+
+  /* Not every map has open water */
+  for (y = 0; y < MAP_Y && !water; y++) {
+    for (x = 0; x < MAP_X && !water; x++) {
+      water = (world.cur_map->map[y][x] == ter_water && !world.cur_map->cmap[y][x]);
+    }
+  }
+  if (!water) {
+    return;
+  }
 
   do {
     rand_pos(pos);
@@ -1192,8 +1067,8 @@ void new_char_other()
 
   do {
     rand_pos(pos);
-  } while (world.rival_dist[pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
-           world.rival_dist[pos[dim_y]][pos[dim_x]] < 0                  ||
+  } while (world.dist[char_rival][pos[dim_y]][pos[dim_x]] == DIJKSTRA_PATH_MAX ||
+           world.dist[char_rival][pos[dim_y]][pos[dim_x]] < 0                  ||
            world.cur_map->cmap[pos[dim_y]][pos[dim_x]]                   ||
            pos[dim_x] < 3 || pos[dim_x] > MAP_X - 4                      ||
            pos[dim_y] < 3 || pos[dim_y] > MAP_Y - 4);
@@ -1202,7 +1077,7 @@ void new_char_other()
   c->pos[dim_y] = pos[dim_y];
   c->pos[dim_x] = pos[dim_x];
   c->ctype = char_other;
-  switch (rand() % 4) {
+  switch (rngStream(rng_trainer).nextInt() % 4) {
   case 0:
     c->mtype = move_pace;
     c->symbol = PACER_SYMBOL;
@@ -1237,7 +1112,7 @@ void place_characters()
   new_swimmer();
   do {
     //higher probability of non- hikers and rivals
-    switch(rand() % 10) {
+    switch(rngStream(rng_trainer).nextInt() % 10) {
     case 0:
       new_hiker();
       break;
@@ -1256,7 +1131,7 @@ void place_characters()
      * impossible (or very difficult) to continue to add, so we abort if *
      * we've tried MAX_TRAINER_TRIES times.                              */
   } while (++world.cur_map->num_trainers < MIN_TRAINERS ||
-           ((rand() % 100) < ADD_TRAINER_PROB));
+           ((rngStream(rng_trainer).nextInt() % 100) < ADD_TRAINER_PROB));
 }
 
 void init_pc()
@@ -1264,8 +1139,8 @@ void init_pc()
   int x, y;
 
   do {
-    x = rand() % (MAP_X - 2) + 1;
-    y = rand() % (MAP_Y - 2) + 1;
+    x = rngStream(rng_world).nextInt() % (MAP_X - 2) + 1;
+    y = rngStream(rng_world).nextInt() % (MAP_Y - 2) + 1;
   } while (world.cur_map->map[y][x] != ter_path);
 
   world.pc.pos[dim_x] = x;
@@ -1321,6 +1196,7 @@ int new_map(int teleport)
 
   world.cur_map = new map;
   world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x]] = world.cur_map;
+  world.dist_map = NULL;
 
   smooth_height(world.cur_map);
   
@@ -1329,28 +1205,28 @@ int new_map(int teleport)
   } else if (world.world[world.cur_idx[dim_y] - 1][world.cur_idx[dim_x]]) {
     n = world.world[world.cur_idx[dim_y] - 1][world.cur_idx[dim_x]]->s;
   } else {
-    n = 3 + rand() % (MAP_X - 6);
+    n = 3 + rngStream(rng_world).nextInt() % (MAP_X - 6);
   }
   if (world.cur_idx[dim_y] == WORLD_SIZE - 1) {
     s = -1;
   } else if (world.world[world.cur_idx[dim_y] + 1][world.cur_idx[dim_x]]) {
     s = world.world[world.cur_idx[dim_y] + 1][world.cur_idx[dim_x]]->n;
   } else  {
-    s = 3 + rand() % (MAP_X - 6);
+    s = 3 + rngStream(rng_world).nextInt() % (MAP_X - 6);
   }
   if (!world.cur_idx[dim_x]) {
     w = -1;
   } else if (world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x] - 1]) {
     w = world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x] - 1]->e;
   } else {
-    w = 3 + rand() % (MAP_Y - 6);
+    w = 3 + rngStream(rng_world).nextInt() % (MAP_Y - 6);
   }
   if (world.cur_idx[dim_x] == WORLD_SIZE - 1) {
     e = -1;
   } else if (world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x] + 1]) {
     e = world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x] + 1]->w;
   } else {
-    e = 3 + rand() % (MAP_Y - 6);
+    e = 3 + rngStream(rng_world).nextInt() % (MAP_Y - 6);
   }
   
   map_terrain(world.cur_map, n, s, e, w);
@@ -1362,10 +1238,10 @@ int new_map(int teleport)
        abs(world.cur_idx[dim_y] - (WORLD_SIZE / 2)));
   p = d > 200 ? 5 : (50 - ((45 * d) / 200));
   //  printf("d=%d, p=%d\n", d, p);
-  if ((rand() % 100) < p || !d) {
+  if ((rngStream(rng_world).nextInt() % 100) < p || !d) {
     place_pokemart(world.cur_map);
   }
-  if ((rand() % 100) < p || !d) {
+  if ((rngStream(rng_world).nextInt() % 100) < p || !d) {
     place_center(world.cur_map);
   }
 
@@ -1394,7 +1270,7 @@ int new_map(int teleport)
              (move_cost[char_pc][world.cur_map->map[world.pc.pos[dim_y]]
                                                    [world.pc.pos[dim_x]]] ==
               DIJKSTRA_PATH_MAX)                                           ||
-             world.rival_dist[world.pc.pos[dim_y]][world.pc.pos[dim_x]] < 0);
+             world.dist[char_rival][world.pc.pos[dim_y]][world.pc.pos[dim_x]] < 0);
     world.cur_map->cmap[world.pc.pos[dim_y]][world.pc.pos[dim_x]] = &world.pc;
     pathfind(world.cur_map);
   }
@@ -1428,33 +1304,19 @@ void delete_world()
   }
 }
 
-void print_hiker_dist()
+/* Debugging aid: the distance map of any character type, brought *
+ * up to date first, two digits per cell                           */
+void print_dist(character_type_t ctype)
 {
   int x, y;
 
+  pathfind_types(world.cur_map, 1u << ctype);
   for (y = 0; y < MAP_Y; y++) {
     for (x = 0; x < MAP_X; x++) {
-      if (world.hiker_dist[y][x] == DIJKSTRA_PATH_MAX) {
+      if (world.dist[ctype][y][x] == DIJKSTRA_PATH_MAX) {
         printf("   ");
       } else {
-        printf(" %02d", world.hiker_dist[y][x] % 100);
-      }
-    }
-    printf("\n");
-  }
-}
-
-void print_rival_dist()
-{
-  int x, y;
-
-  for (y = 0; y < MAP_Y; y++) {
-    for (x = 0; x < MAP_X; x++) {
-      if (world.rival_dist[y][x] == DIJKSTRA_PATH_MAX ||
-          world.rival_dist[y][x] < 0) {
-        printf("   ");
-      } else {
-        printf(" %02d", world.rival_dist[y][x] % 100);
+        printf(" %02d", world.dist[ctype][y][x] % 100);
       }
     }
     printf("\n");
@@ -1537,18 +1399,13 @@ void game_loop()
     if(p) {
     // Check if the character is in tall grass
     if(world.cur_map->map[c->pos[dim_y]][c->pos[dim_x]] == ter_grass) {
-        // Initialize a random number generator
-        std::random_device rd; // Obtain a random number from hardware
-        std::mt19937 gen(rd()); // Seed the generator
-        std::uniform_int_distribution<> distr(1, 100); // Define the range [1, 100]
-
-        int chance = distr(gen); // Generate a random number in the range [1, 100]
+        int chance = rngStream(rng_encounter).range(1, 100); // Generate a random number in the range [1, 100]
 
         // There's a 10% chance to call generatePokemon
         if(chance <= 10) { // 10% chance
           int manDis = determine_man_dis(c);
-            PokeData* poke = generatePokemon(manDis, 0);
-            io_display_found_pokemon(&world.pc, *poke);
+            PokeData poke = generatePokemon(manDis, 0);
+            io_display_found_pokemon(&world.pc, poke);
         }
     }
 }
@@ -1557,9 +1414,222 @@ void game_loop()
   }
 }
 
+/* Soak mode: a headless run for spotting leaks.  The PC wanders at    *
+ * random, trainer battles play themselves, and every SOAK_FLY_TURNS   *
+ * PC turns it flies to a random map, freeing the one it leaves, so a  *
+ * leak-free build holds a flat resident size over any length of run. */
+#define SOAK_REPORT_TURNS 10000
+#define SOAK_FLY_TURNS    500
+
+static long resident_kib()
+{
+  long size, resident = 0;
+  FILE *f = fopen("/proc/self/statm", "r");
+
+  if (f) {
+    if (fscanf(f, "%ld %ld", &size, &resident) != 2) {
+      resident = 0;
+    }
+    fclose(f);
+  }
+  return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static void soak_move_pc(pair_t dest)
+{
+  int first = rngStream(rng_world).nextInt() & 0x7;
+  int i, x, y;
+
+  dest[dim_x] = world.pc.pos[dim_x];
+  dest[dim_y] = world.pc.pos[dim_y];
+  for (i = 0; i < 8; i++) {
+    x = world.pc.pos[dim_x] + all_dirs[(first + i) & 0x7][dim_x];
+    y = world.pc.pos[dim_y] + all_dirs[(first + i) & 0x7][dim_y];
+    /* Off the border, so the PC never leaves through a gate */
+    if (x > 0 && x < MAP_X - 1 && y > 0 && y < MAP_Y - 1 &&
+        !world.cur_map->cmap[y][x]                        &&
+        move_cost[char_pc][world.cur_map->map[y][x]] != DIJKSTRA_PATH_MAX) {
+      dest[dim_x] = x;
+      dest[dim_y] = y;
+      return;
+    }
+  }
+}
+
+static void soak_fly()
+{
+  /* The PC is out of the turn queue, so this frees only the NPCs */
+  heap_delete(&world.cur_map->turn);
+  delete world.cur_map;
+  world.world[world.cur_idx[dim_y]][world.cur_idx[dim_x]] = NULL;
+
+  /* Along the center row: every distance, hence every trainer level, *
+   * comes up without paging in the whole world table                  */
+  world.cur_idx[dim_x] = rngStream(rng_world).range(0, WORLD_SIZE - 1);
+  world.cur_idx[dim_y] = WORLD_SIZE / 2;
+  if (world.cur_idx[dim_x] == WORLD_SIZE / 2) {
+    /* The center map would hand out another starter */
+    world.cur_idx[dim_x]++;
+  }
+  new_map(1);
+}
+
+static int soak(long turns)
+{
+  character *c;
+  npc *n;
+  pair_t d;
+  long turn, pc_turns = 0;
+
+  world.headless = 1;
+  init_world();
+  pathfind(world.cur_map);
+
+  printf("turn 0: %ld KiB resident\n", resident_kib());
+  for (turn = 1; turn <= turns; turn++) {
+    c = (character *) heap_remove_min(&world.cur_map->turn);
+    n = dynamic_cast<npc *> (c);
+
+    if (n) {
+      move_func[n->mtype](c, d);
+    } else {
+      soak_move_pc(d);
+    }
+
+    world.cur_map->cmap[c->pos[dim_y]][c->pos[dim_x]] = NULL;
+    world.cur_map->cmap[d[dim_y]][d[dim_x]] = c;
+    c->next_turn += move_cost[n ? n->ctype : char_pc]
+                             [world.cur_map->map[d[dim_y]][d[dim_x]]];
+    c->pos[dim_y] = d[dim_y];
+    c->pos[dim_x] = d[dim_x];
+
+    if (!n) {
+      if (world.cur_map->map[d[dim_y]][d[dim_x]] == ter_grass &&
+          rngStream(rng_encounter).range(1, 100) <= 10) {
+        PokeData wild = generatePokemon(determine_man_dis(c), 0);
+        if (world.pc.getPokemons().size() < 6) {
+          world.pc.addPokemon(std::move(wild));
+        }
+      }
+      /* A beaten party goes straight to a Pokemon Center */
+      if (std::none_of(world.pc.getPokemons().begin(), world.pc.getPokemons().end(),
+                       [](const PokeData &p) { return p.getHP() > 0; })) {
+        world.pc.healAllPokemon();
+      }
+      if (!(++pc_turns % SOAK_FLY_TURNS)) {
+        soak_fly();
+      }
+      pathfind(world.cur_map);
+    }
+    heap_insert(&world.cur_map->turn, c);
+
+    if (!(turn % SOAK_REPORT_TURNS)) {
+      printf("turn %ld: %ld KiB resident, lead Pokemon at level %d\n", turn, resident_kib(),
+             world.pc.getPokemons().empty() ? 0 : world.pc.getPokemons()[0].getLevel());
+      fflush(stdout);
+    }
+  }
+
+  return 0;
+}
+
+#define BENCH_PATHS_REPS 20
+
+/* Seconds per call of f, over BENCH_PATHS_REPS calls */
+template <class F>
+static double bench_time(F f)
+{
+  struct timespec start, end;
+  int i;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < BENCH_PATHS_REPS; i++) {
+    f();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return ((end.tv_sec - start.tv_sec) +
+          (end.tv_nsec - start.tv_nsec) / 1e9) / BENCH_PATHS_REPS;
+}
+
+/* Time the distance maps and the road builder on `maps` seeded maps, *
+ * with the Fibonacci heap and with the queues they use now; the maps *
+ * once more with both types built at once on the worker pool.        */
+static int bench_paths(int maps)
+{
+  static int hiker[MAP_Y][MAP_X], rival[MAP_Y][MAP_X];
+  static map scratch;
+  static fibonacci_queue heap;
+  double field_time[3] = { 0, 0, 0 }, road_time[2] = { 0, 0 };
+  int i, roads = 0, mismatches = 0;
+  pair_t from, to;
+  map *m;
+
+  world.headless = 1;
+  init_world();
+  for (i = 0; i < maps; i++) {
+    if (i) {
+      soak_fly();
+    }
+    m = world.cur_map;
+
+    field_time[0] += bench_time([m]() {
+      pathfind_rebuild(m, rebuild_fibonacci);
+    });
+    memcpy(hiker, world.dist[char_hiker], sizeof (hiker));
+    memcpy(rival, world.dist[char_rival], sizeof (rival));
+    field_time[1] += bench_time([m]() { pathfind_rebuild(m, rebuild_serial); });
+    mismatches += (memcmp(hiker, world.dist[char_hiker], sizeof (hiker)) ||
+                   memcmp(rival, world.dist[char_rival], sizeof (rival)));
+    field_time[2] += bench_time([m]() {
+      pathfind_rebuild(m, rebuild_parallel);
+    });
+    mismatches += (memcmp(hiker, world.dist[char_hiker], sizeof (hiker)) ||
+                   memcmp(rival, world.dist[char_rival], sizeof (rival)));
+
+    /* The west to east road, laid again over the finished map */
+    if (m->w != -1 && m->e != -1) {
+      from[dim_x] = 1;
+      from[dim_y] = m->w;
+      to[dim_x] = MAP_X - 2;
+      to[dim_y] = m->e;
+      road_time[0] += bench_time([&]() {
+        memcpy(scratch.map, m->map, sizeof (m->map));
+        memcpy(scratch.height, m->height, sizeof (m->height));
+        dijkstra_path(&scratch, from, to, heap);
+      });
+      road_time[1] += bench_time([&]() {
+        memcpy(scratch.map, m->map, sizeof (m->map));
+        memcpy(scratch.height, m->height, sizeof (m->height));
+        dijkstra_path(&scratch, from, to, road_queue);
+      });
+      roads++;
+    }
+  }
+
+  printf("distance maps: %.1f us with the Fibonacci heap, %.1f us with "
+         "buckets (%.1fx), %.1f us with both at once on %u threads "
+         "(%.1fx); %s\n",
+         field_time[0] / maps * 1e6, field_time[1] / maps * 1e6,
+         field_time[0] / field_time[1], field_time[2] / maps * 1e6,
+         ThreadPool::shared().size(), field_time[0] / field_time[2],
+         mismatches ? "MAPS DIFFER" : "identical maps");
+  if (roads) {
+    printf("roads:         %.1f us with the Fibonacci heap, %.1f us with "
+           "the radix heap (%.1fx)\n",
+           road_time[0] / roads * 1e6, road_time[1] / roads * 1e6,
+           road_time[0] / road_time[1]);
+  }
+
+  return mismatches != 0;
+}
+
 void usage(char *s)
 {
-  fprintf(stderr, "Usage: %s [-s|--seed <seed>]\n", s);
+  fprintf(stderr, "Usage: %s [-s|--seed <seed>] [-l|--lookahead <ms>]\n"
+          "       %s -b|--balance <battles> [--species <count>] [--levels <l1,l2,...>] [-o|--output <file>]\n"
+          "       %s --soak <turns> [-s|--seed <seed>]\n"
+          "       %s --bench-paths <maps> [-s|--seed <seed>]\n", s, s, s, s);
 
   exit(1);
 }
@@ -1567,12 +1637,14 @@ void usage(char *s)
 
 int main(int argc, char *argv[])
 {
-  printf("treying to read path");
   initializeDataLists();
    struct timeval tv;
   uint32_t seed;
   int do_seed = 1;
   //char *filetype = NULL;
+  BalanceOptions balance = { 0, 151, { 5, 25, 50 }, "balance.csv", 0 };
+  long soak_turns = 0;
+  int bench_maps = 0;
 
  // Parse command-line arguments
     for (int i = 1; i < argc; i++) {
@@ -1583,6 +1655,51 @@ int main(int argc, char *argv[])
             } else {
                 usage(argv[0]); // Incorrect usage, missing seed value after -s or --seed
             }
+        } else if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--lookahead") == 0) {
+            if (i + 1 < argc) { // Per-decision budget of the Monte Carlo trainer AI
+                trainerLookaheadMs = atof(argv[++i]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "-b") == 0 || strcmp(argv[i], "--balance") == 0) {
+            if (i + 1 < argc) { // Headless matchup sweep instead of the game
+                balance.battles = atoi(argv[++i]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--species") == 0) {
+            if (i + 1 < argc) {
+                balance.species = atoi(argv[++i]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--levels") == 0) {
+            if (i + 1 < argc) {
+                balance.levels.clear();
+                for (char *level = strtok(argv[++i], ","); level; level = strtok(NULL, ",")) {
+                    balance.levels.push_back(atoi(level));
+                }
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--soak") == 0) {
+            if (i + 1 < argc) { // Headless leak check instead of the game
+                soak_turns = atol(argv[++i]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "--bench-paths") == 0) {
+            if (i + 1 < argc) { // Shortest-path timings instead of the game
+                bench_maps = atoi(argv[++i]);
+            } else {
+                usage(argv[0]);
+            }
+        } else if (strcmp(argv[i], "-o") == 0 || strcmp(argv[i], "--output") == 0) {
+            if (i + 1 < argc) {
+                balance.output = argv[++i];
+            } else {
+                usage(argv[0]);
+            }
         } else {
             usage(argv[0]); // Incorrect usage, unknown argument
         }
@@ -1594,7 +1711,19 @@ int main(int argc, char *argv[])
         seed = (tv.tv_usec ^ (tv.tv_sec << 20)) & 0xffffffff;
     }
   printf("Using seed: %u\n", seed);
-  srand(seed);
+  seedRng(seed);
+
+  if (balance.battles > 0) {
+    balance.seed = seed;
+    return runBalance(balance);
+  }
+  RosterPool::shared().start(rngStream(rng_roster));
+  if (soak_turns > 0) {
+    return soak(soak_turns);
+  }
+  if (bench_maps > 0) {
+    return bench_paths(bench_maps);
+  }
 
 
     //generatePokemon(1,0);
@@ -8,6 +8,7 @@
 # include "character.h"
 # include "pair.h"
 # include "data.h"
+# include "rng.h"
 
 #define malloc(size) ({                 \
   char *_tmp;                           \
@@ -18,10 +19,10 @@
 /* Returns true if random float in [0,1] is less than *
  * numerator/denominator.  Uses only integer math.    */
 # define rand_under(numerator, denominator) \
-  (rand() < ((RAND_MAX / denominator) * numerator))
+  (rngStream(rng_world).nextInt() < ((INT32_MAX / denominator) * numerator))
 
 /* Returns random integer in [min, max]. */
-# define rand_range(min, max) ((rand() % (((max) + 1) - (min))) + (min))
+# define rand_range(min, max) (rngStream(rng_world).range((min), (max)))
 
 # define UNUSED(f) ((void) f)
 
@@ -81,7 +82,7 @@ typedef enum __attribute__ ((__packed__)) terrain_type {
   ter_debug
 } terrain_type_t;
 
-extern int32_t move_cost[num_character_types][num_terrain_types];
+extern const int32_t move_cost[num_character_types][num_terrain_types];
 
 class map {
  public:
@@ -100,10 +101,17 @@ class world {
   map *cur_map;
   /* Please distance maps in world, not map, since *
    * we only need one pair at any given time.      */
-  int hiker_dist[MAP_Y][MAP_X];
-  int rival_dist[MAP_Y][MAP_X];
+  int dist[num_character_types][MAP_Y][MAP_X];
+  /* The map and PC position the distance maps were last built for,  *
+   * and which types' maps are current (bit 1 << character_type_t);  *
+   * cleared whenever a map is allocated, as it may reuse an address */
+  map *dist_map;
+  pair_t dist_source;
+  uint32_t dist_types;
   class pc pc;
   int quit;
+  /* Soak runs: no terminal, and battles play themselves */
+  int headless;
   int add_trainer_prob;
   int char_seq_num;
 };
@@ -115,7 +123,7 @@ extern class world world;
 extern pair_t all_dirs[8];
 
 #define rand_dir(dir) {     \
-  int _i = rand() & 0x7;    \
+  int _i = rngStream(rng_trainer).next() & 0x7; \
   dir[0] = all_dirs[_i][0]; \
   dir[1] = all_dirs[_i][1]; \
 }
@@ -128,6 +136,26 @@ typedef struct path {
 } path_t;
 
 int new_map(int teleport);
+/* Hikers and rivals chase the PC down their distance maps */
+#define DIST_CHASERS ((1u << char_hiker) | (1u << char_rival))
+/* Bring the distance maps of a set of character types up to date */
+void pathfind_types(map *m, uint32_t types);
+/* The same for DIST_CHASERS, once per PC turn */
 void pathfind(map *m);
+/* Both chasers' distance maps from scratch, for --bench-paths: with *
+ * the Fibonacci heap, or with buckets one map after the other or     *
+ * both at once on the worker pool                                    */
+typedef enum rebuild {
+  rebuild_fibonacci,
+  rebuild_serial,
+  rebuild_parallel
+} rebuild_t;
+void pathfind_rebuild(map *m, rebuild_t how);
+
+struct PokeData;
+/* A species drawn uniformly from the first 151 */
+const Pokemon* getRandomPokemon(RngStream& rng);
+/* Fill in a level `level` `pokemon`: its moves, stats and shininess */
+void buildPokemon(PokeData *pokeData, const Pokemon &pokemon, int level, RngStream &rng);
 
 #endif
@@ -0,0 +1,167 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "pokedex.h"
+#include "snapshot.h"
+#include "threadpool.h"
+
+Pokedex pokedex;
+
+bool readFileFromDirectories(const std::string& relativeFilePath, std::string& fullPath) {
+    std::vector<std::string> basePaths = {
+        "/share/cs327/",
+        getenv("HOME") + std::string("/.poke327/"),
+        "/mnt/c/Users/gabri/CS/personal projects/Pokemon/DB/"
+    };
+
+    //std::string fullPath;
+    std::ifstream file;
+
+    for (const auto& basePath : basePaths) {
+        fullPath = basePath + "pokedex/pokedex/data/csv/" + relativeFilePath;
+        file.open(fullPath);
+        if (file) {
+            return true; // File was found and read
+        }
+    }
+
+   fullPath.clear(); // Clear fullPath if the file was not found
+    return false; // File was not found
+}
+
+DataObjectList* parseDataType(const std::string& relativeFilePath, const std::string& fullPath){
+
+  DataObjectList* list;
+  if(relativeFilePath == "pokemon.csv"){
+     list = new PokemonList(fullPath);
+  }else if(relativeFilePath == "moves.csv"){
+     list = new MovesList(fullPath);
+  }else if(relativeFilePath == "pokemon_moves.csv"){
+     list = new PokemonMovesList(fullPath);
+  }else if(relativeFilePath == "pokemon_species.csv"){
+     list = new PokemonSpeciesList(fullPath);
+  }else if(relativeFilePath == "experience.csv"){
+     list = new ExperienceList(fullPath);
+  }else if(relativeFilePath == "type_names.csv"){
+     list = new TypeNamesList(fullPath);
+  }else if(relativeFilePath == "pokemon_stats.csv"){
+     list = new PokemonStatsList(fullPath);
+  }else if(relativeFilePath == "stats.csv"){
+     list = new StatsList(fullPath);
+  }else if(relativeFilePath == "pokemon_types.csv"){
+     list = new PokemonTypesList(fullPath);
+  }else if(relativeFilePath == "type_efficacy.csv"){
+     list = new TypeEfficacyList(fullPath);
+  }else{
+    return nullptr;
+  }
+  list->indexRows();
+  return list;
+
+}
+
+// Parse a CSV into T directly
+template <class T>
+static std::unique_ptr<T> parseTable(const std::string& fullPath) {
+    return std::make_unique<T>(fullPath);
+}
+
+// pokemon_moves.csv dwarfs every other table, so it is cut into line-aligned
+// chunks that are parsed in parallel and then concatenated in file order.
+template <>
+std::unique_ptr<PokemonMovesList> parseTable<PokemonMovesList>(const std::string& fullPath) {
+    CSVFile file;
+    if (!file.open(fullPath)) {
+        return std::make_unique<PokemonMovesList>(fullPath);
+    }
+    ThreadPool& pool = ThreadPool::shared();
+    const char* rows = CSVReader::nextLine(file.begin(), file.end()); // skip the header
+    std::vector<const char*> bounds = CSVReader::splitLines(rows, file.end(), pool.size() * 4);
+
+    std::vector<std::unique_ptr<PokemonMovesList>> chunks(bounds.size() - 1);
+    pool.parallelFor(chunks.size(), [&](size_t i) {
+        chunks[i] = std::make_unique<PokemonMovesList>(bounds[i], bounds[i + 1]);
+    });
+
+    std::unique_ptr<PokemonMovesList> table = std::make_unique<PokemonMovesList>(rows, rows);
+    size_t total = 0;
+    for (const auto& chunk : chunks) {
+        total += chunk->size();
+    }
+    table->reserve(total);
+    for (const auto& chunk : chunks) {
+        table->append(std::move(*chunk));
+    }
+    return table;
+}
+
+// Read one table, leaving it empty (nullptr) if the file cannot be found.
+// A fresh binary snapshot is mapped in place of the CSV when available;
+// otherwise the CSV is parsed and a new snapshot written for next time.
+// Either way the table's lookup indexes are built before it is published.
+template <class T>
+static std::unique_ptr<T> loadTable(const std::string& relativeFilePath) {
+    std::string fullPath;
+    if (!readFileFromDirectories(relativeFilePath, fullPath)) {
+        return nullptr;
+    }
+
+    SnapshotSource source;
+    std::string cachePath = snapshotPath(relativeFilePath);
+    bool cacheable = !cachePath.empty() && statSource(fullPath, source);
+
+    if (cacheable) {
+        TableSnapshot snapshot;
+        if (snapshot.open(cachePath, source, T::SNAPSHOT_COLUMNS)) {
+            std::unique_ptr<T> table = std::make_unique<T>(snapshot);
+            table->indexRows();
+            return table;
+        }
+    }
+
+    std::unique_ptr<T> table = parseTable<T>(fullPath);
+    if (cacheable) {
+        TableSnapshotWriter writer(T::SNAPSHOT_COLUMNS);
+        table->saveRecords(writer);
+        writer.write(cachePath, source);
+    }
+    table->indexRows();
+    return table;
+}
+
+// Queue loadTable<T> on the shared pool
+template <class T>
+static std::shared_future<std::unique_ptr<T>> startTable(const std::string& relativeFilePath) {
+    return ThreadPool::shared().submit([relativeFilePath]() {
+        return loadTable<T>(relativeFilePath);
+    }).share();
+}
+
+void Pokedex::load() {
+    // Biggest first, so the long pole starts as early as possible
+    pokemonMovesList = startTable<PokemonMovesList>("pokemon_moves.csv");
+    movesList = startTable<MovesList>("moves.csv");
+    pokemonStatsList = startTable<PokemonStatsList>("pokemon_stats.csv");
+    statsList = startTable<StatsList>("stats.csv");
+    pokemonList = startTable<PokemonList>("pokemon.csv");
+    pokemonSpeciesList = startTable<PokemonSpeciesList>("pokemon_species.csv");
+    experienceList = startTable<ExperienceList>("experience.csv");
+    typeNamesList = startTable<TypeNamesList>("type_names.csv");
+    pokemonTypesList = startTable<PokemonTypesList>("pokemon_types.csv");
+    typeEfficacyList = startTable<TypeEfficacyList>("type_efficacy.csv");
+}
+
+void Pokedex::wait() const {
+    pokemon();
+    moves();
+    pokemonMoves();
+    pokemonSpecies();
+    experience();
+    typeNames();
+    pokemonStats();
+    stats();
+    pokemonTypes();
+    typeEfficacy();
+}
@@ -0,0 +1,63 @@
+// pokedex.h
+#ifndef POKEDEX_H
+#define POKEDEX_H
+
+#include <string>
+#include <memory>
+#include <future>
+#include "data.h"
+
+// Locates a pokedex CSV in the known data directories
+bool readFileFromDirectories(const std::string& relativeFilePath, std::string& fullPath);
+
+// Builds the DataObjectList matching a CSV file name (nullptr if unknown)
+DataObjectList* parseDataType(const std::string& relativeFilePath, const std::string& fullPath);
+
+// Process-wide catalog owning every Pokedex table.  load() starts reading
+// all the CSV files concurrently on the shared thread pool and returns at
+// once; each accessor blocks only until its own table is ready, so the game
+// waits just for what it actually touches.  Accessors return nullptr for
+// tables whose file was not found (or if load() was never called).
+class Pokedex {
+private:
+    template <class T>
+    using Table = std::shared_future<std::unique_ptr<T>>;
+
+    Table<PokemonList> pokemonList;
+    Table<MovesList> movesList;
+    Table<PokemonMovesList> pokemonMovesList;
+    Table<PokemonSpeciesList> pokemonSpeciesList;
+    Table<ExperienceList> experienceList;
+    Table<TypeNamesList> typeNamesList;
+    Table<PokemonStatsList> pokemonStatsList;
+    Table<StatsList> statsList;
+    Table<PokemonTypesList> pokemonTypesList;
+    Table<TypeEfficacyList> typeEfficacyList;
+
+    // Wait for a table and return it (rethrows any error raised loading it)
+    template <class T>
+    static const T* ready(const Table<T>& table) {
+        return table.valid() ? table.get().get() : nullptr;
+    }
+
+public:
+    // Start reading every table; safe to call only once
+    void load();
+    // Block until every table has finished loading
+    void wait() const;
+
+    const PokemonList* pokemon() const { return ready(pokemonList); }
+    const MovesList* moves() const { return ready(movesList); }
+    const PokemonMovesList* pokemonMoves() const { return ready(pokemonMovesList); }
+    const PokemonSpeciesList* pokemonSpecies() const { return ready(pokemonSpeciesList); }
+    const ExperienceList* experience() const { return ready(experienceList); }
+    const TypeNamesList* typeNames() const { return ready(typeNamesList); }
+    const PokemonStatsList* pokemonStats() const { return ready(pokemonStatsList); }
+    const StatsList* stats() const { return ready(statsList); }
+    const PokemonTypesList* pokemonTypes() const { return ready(pokemonTypesList); }
+    const TypeEfficacyList* typeEfficacy() const { return ready(typeEfficacyList); }
+};
+
+extern Pokedex pokedex;
+
+#endif // POKEDEX_H
@@ -3,17 +3,50 @@
 #define PRINTS_H
 
 #include "data.h"
+#include "pokedex.h"
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+// Slots of PokeData's stat arrays.  The first six follow stats.csv
+// (stat id - 1); max HP is the ceiling current HP heals back up to.
+typedef enum poke_stat {
+  stat_hp,
+  stat_attack,
+  stat_defense,
+  stat_special_attack,
+  stat_special_defense,
+  stat_speed,
+  stat_max_hp,
+  num_stats
+} stat_t;
+
+extern const char *stat_name[num_stats];
+
+// Stat slot for a PokeStats identifier ("hp", "maxHP", ...); num_stats if unknown
+inline stat_t stat_from_name(const std::string& identifier) {
+    for (int i = 0; i < num_stats; i++) {
+        if (identifier == stat_name[i]) {
+            return (stat_t) i;
+        }
+    }
+    return num_stats;
+}
 
 class PokeStats{
 public:
-    // Constructor to initialize the PokeStats object with an identifier and a rating
-    PokeStats(const std::string& identifier, int rating, int iv)
-        : statIdentifier(identifier), statRating(rating), IV(iv) {}
+    // Constructor to initialize the PokeStats object with a stat slot and a rating
+    PokeStats(stat_t stat, int rating, int iv)
+        : stat(stat), statRating(rating), IV(iv) {}
 
-    // Getter for the stat identifier
-    const std::string& getStatIdentifier() const {
-        return statIdentifier;
+    stat_t getStat() const {
+        return stat;
+    }
+
+    // Display name of the stat; num_stats has none
+    const char* getStatIdentifier() const {
+        return stat < num_stats ? stat_name[stat] : "";
     }
 
     // Getter for the stat rating
@@ -35,53 +68,143 @@ public:
     }
 
 private:
-    std::string statIdentifier; // The identifier for the stat (e.g., "HP", "Attack")
+    stat_t stat; // Slot of the stat (e.g., stat_hp, stat_attack)
     int statRating;
     int IV;
 
 };
 
 
+// Moves a Pokemon can know at once
+#define POKE_MAX_MOVES 4
+
+// PP of a move with no pp in moves.csv (parsed as INT_MAX); it never runs out
+#define MOVE_PP_UNLIMITED UINT8_MAX
+// Cap on the PP of a slot; no real move has more
+#define MOVE_MAX_PP 64
+
+// A learned move: its id in the move catalog and the PP it has left
+struct MoveSlot {
+    uint16_t moveId;
+    uint8_t pp;
+
+    // PP of move when fully restored
+    static uint8_t fullPp(const Moves& move) {
+        return move.getPp() == INT_MAX ? MOVE_PP_UNLIMITED : (uint8_t) std::min(std::max(move.getPp(), 0), MOVE_MAX_PP);
+    }
+};
+
+// One Pokemon.  Species, base stats and moves are kept as references into
+// the resident Pokedex catalog rather than copies, so a PokeData owns no
+// heap memory and copying one into a roster is a plain memcpy.
 class PokeData{
     private: 
-        int level;
-        Pokemon poke;
-        std::vector<Moves> movesList;
-        std::vector<PokeStats> statsList;
-        bool shiny;
+        int level = 0;
+        uint32_t exp = 0;       // total experience, at least the floor of level
+        uint8_t growthRate = 0; // experience.csv growth rate of the species
+        const Pokemon* poke = nullptr;
+        const BaseStats* baseStats = nullptr;
+        std::array<MoveSlot, POKE_MAX_MOVES> moveSlots{};
+        uint8_t numMoves = 0;
+        std::array<int, num_stats> stats{};
+        std::array<uint8_t, num_stats> ivs{};
+        std::array<uint8_t, num_stats> evs{};
+        uint32_t statMask = 0; // bit s set once stat s has been given a value
+        bool shiny = false;
+
+        // Display order of the old string-keyed list: hp, maxHP, then the rest
+        static constexpr stat_t listOrder[num_stats] = {
+            stat_hp, stat_max_hp, stat_attack, stat_defense, stat_special_attack, stat_special_defense, stat_speed
+        };
     public:
     // Getter for level
     int getLevel() const {
         return level;
     }
 
-    // Getter for Pokemon
+    // Getter for Pokemon; a blank Pokemon until setPokemon() is called
     const Pokemon& getPokemon() const {
-        return poke;
+        static const Pokemon none;
+        return poke ? *poke : none;
     }
 
-    // Getter for the entire list of Moves
-    const std::vector<Moves>& getMovesList() const {
-        return movesList;
+    // Number of moves learned
+    size_t getMoveCount() const {
+        return numMoves;
     }
 
-    // Getter for an individual Move by index
+    const MoveSlot& getMoveSlot(size_t index) const {
+        if (index >= numMoves) {
+            throw std::out_of_range("Index out of range");
+        }
+        return moveSlots[index];
+    }
+
+    // An individual Move by index, looked up in the move catalog
     // Note: You should check the index bounds before calling this function
     const Moves& getMove(size_t index) const {
-        if (index >= movesList.size()) {
+        static const Moves none;
+        const MovesList* moves = pokedex.moves();
+        const Moves* move = moves ? moves->findById(getMoveSlot(index).moveId) : nullptr;
+        return move ? *move : none;
+    }
+
+    // PP left in a slot, MOVE_PP_UNLIMITED for moves that never run out
+    int getPp(size_t index) const {
+        return getMoveSlot(index).pp;
+    }
+
+    // Clamped to MOVE_MAX_PP; slots with unlimited PP keep it
+    void setPp(size_t index, int pp) {
+        if (index >= numMoves) {
             throw std::out_of_range("Index out of range");
         }
-        return movesList[index];
+        if (moveSlots[index].pp != MOVE_PP_UNLIMITED) {
+            moveSlots[index].pp = (uint8_t) std::min(std::max(pp, 0), MOVE_MAX_PP);
+        }
     }
 
-   // Getter for the entire list of Stats
-    const std::vector<PokeStats>& getStatsList() const {
-        return statsList;
+    // Refill every move to its full PP
+    void restorePp() {
+        for (size_t i = 0; i < numMoves; i++) {
+            moveSlots[i].pp = MoveSlot::fullPp(getMove(i));
+        }
+    }
+
+    // Indexed stat access
+    bool hasStat(stat_t s) const { return statMask & (1u << s); }
+    int getStat(stat_t s) const { return stats[s]; }
+    void setStat(stat_t s, int value) { stats[s] = value; statMask |= 1u << s; }
+    int getIV(stat_t s) const { return ivs[s]; }
+    void setIV(stat_t s, int iv) { ivs[s] = (uint8_t) iv; }
+    int getEV(stat_t s) const { return evs[s]; }
+    void setEV(stat_t s, int ev) { evs[s] = (uint8_t) ev; }
+
+    int getHP() const { return stats[stat_hp]; }
+    int getMaxHP() const { return stats[stat_max_hp]; }
+    void setHP(int hp) { setStat(stat_hp, hp); }
+
+    // Compatibility view of the stats as the old per-stat list.  Built
+    // on each call, so use getStat()/setStat() for anything hot or mutating.
+    std::vector<PokeStats> getStatsList() const {
+        std::vector<PokeStats> list;
+        for (stat_t s : listOrder) {
+            if (hasStat(s)) {
+                list.push_back(PokeStats(s, stats[s], ivs[s]));
+            }
+        }
+        return list;
     }
 
-    // Non-const version of getStatsList
-    std::vector<PokeStats>& getStatsList() {
-        return statsList;
+    // Species base stats / effort yields this Pokemon was generated from
+    const BaseStats& getBaseStats() const {
+        static const BaseStats none = {};
+        return baseStats ? *baseStats : none;
+    }
+
+    // stats must be a catalog entry, which outlives every PokeData
+    void setBaseStats(const BaseStats& stats) {
+        baseStats = &stats;
     }
 
     // Setter for level
@@ -89,51 +212,57 @@ class PokeData{
         level = newLevel;
     }
 
-    // Setter for Pokemon
-    void setPokemon(const Pokemon& newPoke) {
-        poke = newPoke;
-    }
+    int getExp() const { return exp; }
+    void setExp(int newExp) { exp = (uint32_t) std::max(newExp, 0); }
+    int getGrowthRate() const { return growthRate; }
+    void setGrowthRate(int rate) { growthRate = (uint8_t) rate; }
 
-    // Setter for the entire list of Moves
-    void setMovesList(const std::vector<Moves>& newMovesList) {
-        movesList = newMovesList;
+    // Setter for Pokemon; newPoke must be a catalog entry
+    void setPokemon(const Pokemon& newPoke) {
+        poke = &newPoke;
     }
 
-    // Add a Move to the list of Moves
+    // Learn a move with full PP; ignored once all POKE_MAX_MOVES are known
     void addMove(const Moves& move) {
-        movesList.push_back(move);
+        if (numMoves < POKE_MAX_MOVES) {
+            moveSlots[numMoves++] = MoveSlot{ (uint16_t) move.getId(), MoveSlot::fullPp(move) };
+        }
     }
 
     // Remove a Move from the list by index
     void removeMove(size_t index) {
-        if (index < movesList.size()) {
-            movesList.erase(movesList.begin() + index);
+        if (index < numMoves) {
+            std::copy(moveSlots.begin() + index + 1, moveSlots.begin() + numMoves, moveSlots.begin() + index);
+            moveSlots[--numMoves] = MoveSlot{};
         } else {
             throw std::out_of_range("Index out of range");
         }
     }
 
-    // Add a Stat to the list of Stats
+    // Add a Stat (compatibility wrapper over setStat)
     void addStat(const PokeStats& stat) {
-        statsList.push_back(stat);
+        stat_t s = stat.getStat();
+        if (s == num_stats) {
+            return;
+        }
+        setStat(s, stat.getStatRating());
+        setIV(s, stat.getIV());
         // If adding HP, also add maxHP with the same value
-        if (stat.getStatIdentifier() == "hp") {
-            // Check if maxHP already exists, if not, add it
-            auto maxHPit = std::find_if(statsList.begin(), statsList.end(),
-                                        [](const PokeStats& s) { return s.getStatIdentifier() == "maxHP"; });
-            if (maxHPit == statsList.end()) {
-                statsList.push_back(PokeStats("maxHP", stat.getStatRating(), 0));
-            }
+        if (s == stat_hp && !hasStat(stat_max_hp)) {
+            setStat(stat_max_hp, stat.getStatRating());
         }
     }
 
-    // Remove a Stat from the list by index
+    // Remove a Stat by its index in getStatsList()
     void removeStat(size_t index) {
-        if (index < statsList.size()) {
-            statsList.erase(statsList.begin() + index);
-        } else {
-            throw std::out_of_range("Index out of range");
+        for (stat_t s : listOrder) {
+            if (hasStat(s) && index-- == 0) {
+                statMask &= ~(1u << s);
+                stats[s] = ivs[s] = evs[s] = 0;
+                return;
+            }
         }
+        throw std::out_of_range("Index out of range");
     }
 
     void printPokeData(){
@@ -142,23 +271,25 @@ class PokeData{
         
         printf("\nName: %s\n",  getPokemon().getIdentifier().c_str());
         // Check if there are moves to print
-    if (getMovesList().empty()) {
+    if (!getMoveCount()) {
         printf("No moves learned.\n");
     } else {
         printf("Moves:\n");
-        for (const auto& move : getMovesList()) {
+        for (size_t i = 0; i < getMoveCount(); i++) {
             printf(" - %s \n",
-                   move.getIdentifier().c_str());
+                   getMove(i).getIdentifier().c_str());
         }
     }
 
     // Check if there are stats to print
-    if (getStatsList().empty()) {
+    if (!statMask) {
         printf("No stats available.\n");
     } else {
         printf("Stats:\n");
-        for (const auto& stat : getStatsList()) {
-            printf(" - %s: %d\n", stat.getStatIdentifier().c_str(), stat.getStatRating());
+        for (stat_t s : listOrder) {
+            if (hasStat(s)) {
+                printf(" - %s: %d\n", stat_name[s], stats[s]);
+            }
         }
     }
     }
@@ -171,17 +302,18 @@ class PokeData{
         shiny = isShiny;
     }
 
-    // Method to modify a stat by identifier
+    // Method to modify a stat by identifier (compatibility wrapper over setStat)
     void modifyStat(const std::string& identifier, int newRating) {
-        auto it = std::find_if(statsList.begin(), statsList.end(),
-                               [&identifier](const PokeStats& stat) { return stat.getStatIdentifier() == identifier; });
-        if (it != statsList.end()) {
-            it->setStatRating(newRating);
+        stat_t s = stat_from_name(identifier);
+        if (s != num_stats && hasStat(s)) {
+            stats[s] = newRating;
         }
     }
 
 };
 
+static_assert(std::is_trivially_copyable<PokeData>::value, "rosters copy PokeData as plain bytes");
+
 
 
 
@@ -0,0 +1,14 @@
+#include "rng.h"
+
+static RngStream streams[num_rng_streams];
+
+void seedRng(uint32_t seed) {
+    RngStream root(RngStream::mix(seed));
+    for (int s = 0; s < num_rng_streams; s++) {
+        streams[s] = root.split(s);
+    }
+}
+
+RngStream& rngStream(rng_stream_t stream) {
+    return streams[stream];
+}
@@ -0,0 +1,63 @@
+// rng.h
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+// Independent random streams, one per subsystem, so that (for example) a
+// battle drawing an extra number does not shift the next map or encounter
+typedef enum rng_stream {
+    rng_world,     // map generation and PC placement
+    rng_encounter, // wild Pokemon in tall grass
+    rng_trainer,   // trainer placement, movement and party levels
+    rng_battle,    // fleeing and battle turns
+    rng_roster,    // trainer party Pokemon, built ahead by the roster pool
+    num_rng_streams
+} rng_stream_t;
+
+// Counter-based generator: the n-th output is a mix of (key, n), so a
+// stream is two words, costs nothing to create or copy, and substreams can
+// be split off without drawing from the parent.  Meets the standard
+// UniformRandomBitGenerator requirements, so it works with <algorithm>.
+class RngStream {
+private:
+    uint64_t key;
+    uint64_t counter;
+
+public:
+    typedef uint32_t result_type;
+
+    RngStream() : key(0), counter(0) {}
+    explicit RngStream(uint64_t key) : key(key), counter(0) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+
+    result_type operator()() { return next(); }
+    uint32_t next() { return mix(key + ++counter * 0x9e3779b97f4a7c15ull) >> 32; }
+    // Non-negative int, a drop-in for rand()
+    int nextInt() { return (int) (next() >> 1); }
+    // Uniform in [0, n) for n > 0, without modulo bias
+    uint32_t below(uint32_t n) { return (uint32_t) (((uint64_t) next() * n) >> 32); }
+    // Uniform in [lo, hi]
+    int range(int lo, int hi) { return lo + (int) below((uint32_t) (hi - lo + 1)); }
+    // True with the given percent chance
+    bool chance(int percent) { return (int) below(100) < percent; }
+
+    // Independent stream identified by id; the parent is not advanced
+    RngStream split(uint64_t id) const { return RngStream(mix(key ^ mix(id + 0x632be59bd9b4e019ull))); }
+
+    // SplitMix64 finalizer
+    static uint64_t mix(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+};
+
+// Derive every subsystem stream from the run's seed
+void seedRng(uint32_t seed);
+// The process-wide stream for a subsystem.  Game code only, not thread safe.
+RngStream& rngStream(rng_stream_t stream);
+
+#endif // RNG_H
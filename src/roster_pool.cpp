@@ -0,0 +1,107 @@
+#include <algorithm>
+#include "roster_pool.h"
+#include "poke_main.h"
+
+RosterPool::RosterPool() : stopping(false), idle(false) {
+    for (Band& band : bands) {
+        band.claimed = 0;
+        band.building = false;
+    }
+}
+
+RosterPool::~RosterPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    if (producer.joinable()) {
+        producer.join();
+    }
+}
+
+void RosterPool::start(const RngStream& rng) {
+    for (int b = 0; b < ROSTER_NUM_BANDS; b++) {
+        bands[b].rng = rng.split(b);
+    }
+    producer = std::thread(&RosterPool::produceLoop, this);
+}
+
+int RosterPool::bandOf(int level) {
+    return std::min(std::max(level, 1), 100) / ROSTER_BAND_WIDTH;
+}
+
+PokeData RosterPool::build(int band, const RngStream& rng) {
+    RngStream draw = rng;
+    int lo = std::max(band * ROSTER_BAND_WIDTH, 1);
+    int hi = std::min(band * ROSTER_BAND_WIDTH + ROSTER_BAND_WIDTH - 1, 100);
+    int level = draw.range(lo, hi);
+
+    PokeData pokemon;
+    const Pokemon* species = getRandomPokemon(draw);
+    if (species) {
+        buildPokemon(&pokemon, *species, level, draw);
+    }
+    return pokemon;
+}
+
+void RosterPool::produceLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (!stopping) {
+        int next = -1;
+        for (int b = 0; b < ROSTER_NUM_BANDS; b++) {
+            size_t size = bands[b].ready.size();
+            if (size < ROSTER_BAND_CAPACITY && (next < 0 || size < bands[next].ready.size())) {
+                next = b;
+            }
+        }
+        if (next < 0) {
+            idle = true;
+            wake.wait(guard);
+            idle = false;
+            continue;
+        }
+
+        Band& band = bands[next];
+        RngStream rng = band.rng.split(band.claimed++);
+        band.building = true;
+        guard.unlock();
+        PokeData pokemon = build(next, rng);
+        guard.lock();
+        band.ready.push_back(std::move(pokemon));
+        band.building = false;
+        built.notify_all();
+    }
+}
+
+PokeData RosterPool::take(int level) {
+    int b = bandOf(level);
+    Band& band = bands[b];
+    std::unique_lock<std::mutex> guard(lock);
+    // A Pokemon in progress is the next one in order, so wait for it rather
+    // than build the one after it here
+    built.wait(guard, [&]() { return !band.ready.empty() || !band.building; });
+
+    if (!band.ready.empty()) {
+        PokeData pokemon = std::move(band.ready.front());
+        band.ready.pop_front();
+        // A busy producer picks the band up on its next pass anyway
+        bool wakeProducer = idle;
+        guard.unlock();
+        if (wakeProducer) {
+            wake.notify_one();
+        }
+        return pokemon;
+    }
+
+    // The band ran dry: build its next Pokemon here
+    RngStream rng = band.rng.split(band.claimed++);
+    guard.unlock();
+    wake.notify_one();
+    return build(b, rng);
+}
+
+RosterPool& RosterPool::shared() {
+    static RosterPool pool;
+    return pool;
+}
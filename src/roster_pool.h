@@ -0,0 +1,67 @@
+// roster_pool.h
+#ifndef ROSTER_POOL_H
+#define ROSTER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "prints.h"
+#include "rng.h"
+
+// Level bands: 1-4, 5-9, 10-14, ..., 95-99, 100
+#define ROSTER_BAND_WIDTH    5
+#define ROSTER_NUM_BANDS     (100 / ROSTER_BAND_WIDTH + 1)
+// Ready Pokemon kept per band; a map's trainers usually take fewer
+#define ROSTER_BAND_CAPACITY 16
+
+// Trainer party members built ahead of time by a producer thread, so that
+// placing trainers on a new map only takes Pokemon off a queue.  Each level
+// band keeps up to ROSTER_BAND_CAPACITY ready Pokemon and the producer tops
+// up the emptiest band whenever one is taken.
+//
+// The n-th Pokemon of a band is always built from the same substream of
+// the seed, and take() hands them out in order, so a seeded run sees the
+// same parties however far ahead the producer happens to be.
+class RosterPool {
+private:
+    struct Band {
+        std::deque<PokeData> ready;
+        RngStream rng;
+        uint64_t claimed;  // Pokemon of this band started so far
+        bool building;     // the producer is building this band's next one
+    };
+
+    Band bands[ROSTER_NUM_BANDS];
+    std::thread producer;
+    std::mutex lock;
+    std::condition_variable wake;  // to the producer: a band has room, or stop
+    std::condition_variable built; // to take(): the producer finished one
+    bool stopping;
+    bool idle;                     // the producer is waiting on wake
+
+    void produceLoop();
+    static int bandOf(int level);
+    static PokeData build(int band, const RngStream& rng);
+
+public:
+    RosterPool();
+    // Stops and joins the producer
+    ~RosterPool();
+    RosterPool(const RosterPool&) = delete;
+    RosterPool& operator=(const RosterPool&) = delete;
+
+    // Seed every band and start filling them; call once, after seedRng()
+    void start(const RngStream& rng);
+
+    // A Pokemon whose level is in the same band as level.  Never blocks on
+    // generation unless the band has run dry, in which case the Pokemon is
+    // built on the calling thread.  Game code only, like rngStream().
+    PokeData take(int level);
+
+    // Process-wide pool, created on first use
+    static RosterPool& shared();
+};
+
+#endif // ROSTER_POOL_H
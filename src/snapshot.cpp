@@ -0,0 +1,148 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "snapshot.h"
+
+static const char snapshotMagic[8] = { 'P', 'K', 'D', 'X', 'S', 'N', 'A', 'P' };
+
+// On-disk header; records and then the string pool follow immediately
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t columns;
+    uint64_t sourceSize;
+    int64_t sourceMtime;
+    uint64_t rows;
+    uint64_t stringBytes;
+};
+
+bool statSource(const std::string& path, SnapshotSource& source) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        return false;
+    }
+    source.size = st.st_size;
+    source.mtime = (int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+    return true;
+}
+
+std::string snapshotPath(const std::string& relativeFilePath) {
+    const char* home = getenv("HOME");
+    if (!home) {
+        return "";
+    }
+    std::string dir = std::string(home) + "/.poke327/cache/";
+    // Both levels may be missing on a fresh install
+    mkdir((std::string(home) + "/.poke327").c_str(), 0755);
+    if (mkdir(dir.c_str(), 0755) != 0 && access(dir.c_str(), W_OK) != 0) {
+        return "";
+    }
+    return dir + relativeFilePath + ".snap";
+}
+
+/*TableSnapshot*/
+TableSnapshot::TableSnapshot()
+    : base(nullptr), length(0), records(nullptr), strings(nullptr), rows(0), stringBytes(0), columns(0) {}
+
+TableSnapshot::~TableSnapshot() {
+    if (base) {
+        munmap(base, length);
+    }
+}
+
+bool TableSnapshot::open(const std::string& path, const SnapshotSource& source, uint32_t expectedColumns) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(SnapshotHeader)) {
+        close(fd);
+        return false;
+    }
+    void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+
+    // Every size comes from the file, so check them without letting the
+    // record count overflow, and require the pool to end in a NUL so no
+    // string can run past the mapping
+    const SnapshotHeader* header = (const SnapshotHeader*) mapped;
+    uint64_t bodyLength = (uint64_t) st.st_size - sizeof(SnapshotHeader);
+    uint64_t rowLength = (uint64_t) header->columns * sizeof(int32_t);
+    if (memcmp(header->magic, snapshotMagic, sizeof(snapshotMagic)) ||
+        header->version != SNAPSHOT_VERSION ||
+        header->columns != expectedColumns || header->columns == 0 ||
+        header->sourceSize != source.size ||
+        header->sourceMtime != source.mtime ||
+        header->rows > bodyLength / rowLength ||
+        header->stringBytes != bodyLength - header->rows * rowLength ||
+        (header->stringBytes && ((const char*) mapped)[st.st_size - 1] != '\0')) {
+        munmap(mapped, st.st_size);
+        return false;
+    }
+
+    base = mapped;
+    length = st.st_size;
+    columns = header->columns;
+    rows = header->rows;
+    stringBytes = header->stringBytes;
+    records = (const int32_t*) (header + 1);
+    strings = (const char*) (records + rows * columns);
+    return true;
+}
+
+std::string_view TableSnapshot::string(int32_t offset) const {
+    if (offset < 0 || (uint64_t) offset >= stringBytes) {
+        return std::string_view();
+    }
+    return std::string_view(strings + offset, strnlen(strings + offset, stringBytes - offset));
+}
+
+/*TableSnapshotWriter*/
+void TableSnapshotWriter::addRow(const int32_t* fields) {
+    records.insert(records.end(), fields, fields + columns);
+}
+
+int32_t TableSnapshotWriter::addString(const std::string& value) {
+    auto found = stringOffsets.emplace(value, (int32_t) strings.size());
+    if (found.second) {
+        strings.append(value);
+        strings.push_back('\0');
+    }
+    return found.first->second;
+}
+
+bool TableSnapshotWriter::write(const std::string& path, const SnapshotSource& source) const {
+    SnapshotHeader header;
+    memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = SNAPSHOT_VERSION;
+    header.columns = columns;
+    header.sourceSize = source.size;
+    header.sourceMtime = source.mtime;
+    header.rows = columns ? records.size() / columns : 0;
+    header.stringBytes = strings.size();
+
+    // Write beside the target and rename so readers never see a partial file
+    std::string tmpPath = path + ".tmp";
+    FILE* f = fopen(tmpPath.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(records.data(), sizeof(int32_t), records.size(), f) == records.size() &&
+              fwrite(strings.data(), 1, strings.size(), f) == strings.size();
+    ok = (fclose(f) == 0) && ok;
+    if (!ok || rename(tmpPath.c_str(), path.c_str()) != 0) {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,79 @@
+// snapshot.h
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Bump whenever the record layout of any table (or its CSV filtering) changes
+#define SNAPSHOT_VERSION 1
+
+// Identity of the CSV a snapshot was built from.  A snapshot is only used
+// while the source file still has the same size and modification time.
+struct SnapshotSource {
+    uint64_t size;
+    int64_t mtime; // nanoseconds since the epoch
+};
+
+// Fill in the size/mtime of a source file; false if it cannot be stat'd
+bool statSource(const std::string& path, SnapshotSource& source);
+
+// Cache file used for a given CSV ("" if there is no usable cache directory)
+std::string snapshotPath(const std::string& relativeFilePath);
+
+// Read-only, memory-mapped view of a snapshot file.  Each row is a fixed
+// width array of int32 columns; string columns hold an offset into the
+// string pool that follows the records.
+class TableSnapshot {
+private:
+    void* base;
+    size_t length;
+    const int32_t* records;
+    const char* strings;
+    uint64_t rows;
+    uint64_t stringBytes;
+    uint32_t columns;
+
+public:
+    TableSnapshot();
+    ~TableSnapshot();
+    TableSnapshot(const TableSnapshot&) = delete;
+    TableSnapshot& operator=(const TableSnapshot&) = delete;
+
+    // Map the file at path; false if missing, corrupt or stale
+    bool open(const std::string& path, const SnapshotSource& source, uint32_t columns);
+
+    uint64_t size() const { return rows; }
+    const int32_t* row(uint64_t index) const { return records + index * columns; }
+    // Text of a string column; views the mapping, so copy or intern it
+    std::string_view string(int32_t offset) const;
+};
+
+// Accumulates records for a table and writes them out as a snapshot
+class TableSnapshotWriter {
+private:
+    uint32_t columns;
+    std::vector<int32_t> records;
+    std::string strings;
+    // Offset of every string already in the pool; keyed by copies, since
+    // views into strings would dangle once it grows
+    std::unordered_map<std::string, int32_t> stringOffsets;
+
+public:
+    explicit TableSnapshotWriter(uint32_t columns) : columns(columns) {}
+
+    // Append one row of exactly `columns` fields
+    void addRow(const int32_t* fields);
+    // Intern a string into the pool, returning its offset for a string
+    // column; repeats of a string share the first copy
+    int32_t addString(const std::string& value);
+
+    // Atomically replace the snapshot at path; false on any I/O error
+    bool write(const std::string& path, const SnapshotSource& source) const;
+};
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,42 @@
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include "symbol.h"
+
+// A deque never moves its elements, so the map's keys can view the stored
+// texts directly
+struct SymbolTable {
+    std::mutex lock;
+    std::deque<std::string> texts;
+    std::unordered_map<std::string_view, Symbol> symbols;
+
+    SymbolTable() {
+        texts.emplace_back();
+        symbols.emplace(texts.back(), 0);
+    }
+};
+
+// Created on first use, so interning works during static initialization
+static SymbolTable& symbolTable() {
+    static SymbolTable table;
+    return table;
+}
+
+Symbol intern(std::string_view text) {
+    SymbolTable& table = symbolTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    std::unordered_map<std::string_view, Symbol>::const_iterator it = table.symbols.find(text);
+    if (it != table.symbols.end()) {
+        return it->second;
+    }
+    Symbol symbol = (Symbol) table.texts.size();
+    table.texts.emplace_back(text);
+    table.symbols.emplace(table.texts.back(), symbol);
+    return symbol;
+}
+
+const std::string& symbolText(Symbol symbol) {
+    SymbolTable& table = symbolTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    return table.texts.at(symbol);
+}
@@ -0,0 +1,22 @@
+// symbol.h
+#ifndef SYMBOL_H
+#define SYMBOL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Interned identifier text.  Each distinct string is stored once for the
+// life of the process and named by a 32-bit symbol, so catalog rows carry
+// four bytes per identifier and two identifiers are equal exactly when
+// their symbols are.  Symbol 0 is the empty string.
+typedef uint32_t Symbol;
+
+// The symbol for text, adding it on first sight.  Safe from any thread, so
+// the pokedex loaders can intern while they run in parallel.
+Symbol intern(std::string_view text);
+
+// Text of a symbol; the reference stays valid until exit
+const std::string& symbolText(Symbol symbol);
+
+#endif // SYMBOL_H
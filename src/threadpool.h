@@ -0,0 +1,115 @@
+// threadpool.h
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads draining a FIFO of tasks
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex lock;
+    std::condition_variable wake;
+    bool stopping;
+
+    void workerLoop();
+    void enqueue(std::function<void()> task);
+
+public:
+    // threads == 0 means one worker per hardware thread
+    explicit ThreadPool(unsigned threads = 0);
+    // Runs every task already queued, then joins the workers
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return workers.size(); }
+
+    // Queue f() and return a future for its result (or exception)
+    template <class F>
+    auto submit(F&& f) -> std::future<decltype(f())>;
+
+    // Run body(i) for every i in [0, count) and wait for all of them.  The
+    // calling thread takes indices too, so this is safe to call from inside
+    // a pool task.  The first exception thrown by body is rethrown here.
+    template <class F>
+    void parallelFor(size_t count, F&& body);
+
+    // Process-wide pool, created on first use
+    static ThreadPool& shared();
+};
+
+template <class F>
+auto ThreadPool::submit(F&& f) -> std::future<decltype(f())> {
+    typedef decltype(f()) Result;
+    // std::function needs a copyable callable, so share the packaged_task
+    std::shared_ptr<std::packaged_task<Result()>> task =
+        std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+    std::future<Result> result = task->get_future();
+    enqueue([task]() { (*task)(); });
+    return result;
+}
+
+template <class F>
+void ThreadPool::parallelFor(size_t count, F&& body) {
+    // Helpers may start after every index has been claimed (even after this
+    // call returns), so they only touch state through this shared block and
+    // never call body once next has passed count.
+    struct Work {
+        std::atomic<size_t> next{0};
+        size_t count;
+        size_t finished = 0;
+        std::mutex lock;
+        std::condition_variable done;
+        std::exception_ptr error;
+        std::function<void(size_t)> body;
+    };
+    std::shared_ptr<Work> work = std::make_shared<Work>();
+    work->count = count;
+    work->body = std::forward<F>(body);
+
+    auto drain = [](Work& w) {
+        size_t i;
+        while ((i = w.next.fetch_add(1)) < w.count) {
+            std::exception_ptr error;
+            try {
+                w.body(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> guard(w.lock);
+            if (error && !w.error) {
+                w.error = error;
+            }
+            if (++w.finished == w.count) {
+                w.done.notify_all();
+            }
+        }
+    };
+
+    size_t helpers = count > 1 ? std::min<size_t>(count - 1, size()) : 0;
+    for (size_t h = 0; h < helpers; h++) {
+        enqueue([work, drain]() { drain(*work); });
+    }
+    drain(*work);
+
+    std::unique_lock<std::mutex> guard(work->lock);
+    work->done.wait(guard, [&]() { return work->finished == work->count; });
+    if (work->error) {
+        std::rethrow_exception(work->error);
+    }
+}
+
+#endif // THREADPOOL_H